@@ -0,0 +1,219 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+/**
+ * @brief Options shared by every day's benchmark
+ * Input sizes are swept from minBytes to maxBytes, multiplying by step each time.
+ * Each size is timed samples times, with each sample repeating the solver until
+ * it has run for at least minSampleMs so small inputs still get a stable reading.
+ * Inputs are generated from seed, so runs can be reproduced.
+ */
+typedef struct
+{
+    size_t minBytes;
+    size_t maxBytes;
+    size_t step;
+    int samples;
+    double minSampleMs;
+    uint64_t seed;
+} BenchOptions;
+
+/**
+ * @brief Timing of a single solver at a single input size
+ */
+typedef struct
+{
+    double meanNs;
+    double stddevNs;
+    uint64_t iterations;
+} BenchTiming;
+
+/**
+ * @brief Stops the compiler from discarding solver results
+ */
+static volatile int64_t benchSink;
+
+/**
+ * @brief Parses a byte count with an optional K, M or G suffix
+ *
+ * @param value
+ * @return size_t
+ */
+inline size_t parseBytes(const char *value)
+{
+    char *suffix;
+    size_t bytes = strtoull(value, &suffix, 10);
+
+    switch (*suffix)
+    {
+    case 'G':
+    case 'g':
+        bytes <<= 10;
+        // fall through
+    case 'M':
+    case 'm':
+        bytes <<= 10;
+        // fall through
+    case 'K':
+    case 'k':
+        bytes <<= 10;
+        break;
+    default:
+        break;
+    }
+    return bytes;
+}
+
+/**
+ * @brief Reads the benchmark options from the command line
+ * --min-bytes, --max-bytes, --step, --samples, --min-sample-ms and --seed are supported.
+ * By default inputs are swept from 1 KB to 1 GB.
+ *
+ * @param argc
+ * @param argv
+ * @return BenchOptions
+ */
+inline BenchOptions parseBenchOptions(int argc, char *argv[])
+{
+    BenchOptions options{1ull << 10, 1ull << 30, 4, 5, 20.0, 2022};
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        const char *name = argv[i], *value = argv[i + 1];
+
+        if (strcmp(name, "--min-bytes") == 0)
+        {
+            options.minBytes = parseBytes(value);
+        }
+        else if (strcmp(name, "--max-bytes") == 0)
+        {
+            options.maxBytes = parseBytes(value);
+        }
+        else if (strcmp(name, "--step") == 0)
+        {
+            options.step = strtoull(value, NULL, 10);
+        }
+        else if (strcmp(name, "--samples") == 0)
+        {
+            options.samples = atoi(value);
+        }
+        else if (strcmp(name, "--min-sample-ms") == 0)
+        {
+            options.minSampleMs = atof(value);
+        }
+        else if (strcmp(name, "--seed") == 0)
+        {
+            options.seed = strtoull(value, NULL, 10);
+        }
+        else
+        {
+            fprintf(stderr, "Unknown option %s\n", name);
+            exit(1);
+        }
+    }
+
+    options.step = options.step < 2 ? 2 : options.step;
+    options.samples = options.samples < 1 ? 1 : options.samples;
+
+    return options;
+}
+
+/**
+ * @brief Times a solver
+ * A first run calibrates how many iterations fit in a sample, after which each sample
+ * records the average time per iteration. The mean and standard deviation are taken
+ * across samples.
+ *
+ * @param solver A callable returning the solver's result
+ * @param options
+ * @return BenchTiming
+ */
+template <typename Solver>
+BenchTiming measure(Solver &&solver, const BenchOptions &options)
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point start = Clock::now();
+    benchSink = solver();
+    double calibrationNs = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    uint64_t iterations = (uint64_t)(options.minSampleMs * 1e6 / (calibrationNs + 1.0));
+    iterations = iterations < 1 ? 1 : iterations;
+
+    double sum = 0, sumSquares = 0;
+
+    for (int sample = 0; sample < options.samples; sample++)
+    {
+        start = Clock::now();
+        for (uint64_t i = 0; i < iterations; i++)
+        {
+            benchSink = solver();
+        }
+        double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / iterations;
+
+        sum += ns;
+        sumSquares += ns * ns;
+    }
+
+    double mean = sum / options.samples;
+    double variance = sumSquares / options.samples - mean * mean;
+
+    return {mean, std::sqrt(variance < 0 ? 0 : variance), iterations};
+}
+
+/**
+ * @brief Counts the lines in an input, used as the item count for line based puzzles
+ *
+ * @param input
+ * @return size_t
+ */
+inline size_t countLines(const std::string &input)
+{
+    size_t lines = 1;
+    for (char value : input)
+    {
+        lines += value == '\n';
+    }
+    return lines;
+}
+
+/**
+ * @brief Prints the heading of a day's benchmark table
+ *
+ * @param day
+ */
+inline void printBenchHeader(const char *day)
+{
+    printf("---- %s Benchmark ----\n", day);
+    printf("%-16s %12s %12s %10s %14s %12s %10s\n",
+           "solver", "bytes", "items", "ns/byte", "items/s", "mean ms", "stddev %");
+}
+
+/**
+ * @brief Prints a single row of a day's benchmark table
+ *
+ * @param name
+ * @param bytes
+ * @param items
+ * @param timing
+ */
+inline void printBenchResult(const char *name, size_t bytes, size_t items, BenchTiming timing)
+{
+    printf("%-16s %12zu %12zu %10.3f %14.4g %12.4f %10.2f\n",
+           name, bytes, items,
+           timing.meanNs / bytes,
+           items / (timing.meanNs * 1e-9),
+           timing.meanNs * 1e-6,
+           100.0 * timing.stddevNs / timing.meanNs);
+    fflush(stdout);
+}
+
+#endif /* BENCH_H */
@@ -0,0 +1,297 @@
+#define AOC_NO_MAIN
+#include "day1.cpp"
+#include "bench.h"
+#include "generators.h"
+#include "queries.h"
+#include "parallel.h"
+#include "ranking.h"
+#include "leaderboard.h"
+#include <vector>
+
+/**
+ * @brief The top 3 selector part 2 used before TopK, kept as the baseline for the selector benchmarks.
+ * Keeps an array sorted largest first and inserts with XOR swaps.
+ *
+ * @param value
+ * @param maximums
+ */
+inline void checkMax(int value, int maximums[])
+{
+    int max = TOP_SIZE - 1;
+    int i = max;
+
+    while (i >= 0)
+    {
+        if (maximums[i] > value)
+        {
+            break;
+        }
+        i--;
+    }
+
+    i++;
+
+    while (i <= max)
+    {
+        value ^= maximums[i];
+        maximums[i] ^= value;
+        value ^= maximums[i++];
+    }
+}
+
+/**
+ * @brief Sums the 3 largest totals with checkMax
+ *
+ * @param totals
+ * @return int
+ */
+inline int selectCheckMax(const std::vector<int> &totals)
+{
+    int maximums[TOP_SIZE] = {};
+
+    for (int total : totals)
+    {
+        checkMax(total, maximums);
+    }
+    return maximums[0] + maximums[1] + maximums[2];
+}
+
+/**
+ * @brief Sums the K largest totals with TopK
+ *
+ * @param totals
+ * @return int
+ */
+template <size_t K>
+inline int selectTopK(const std::vector<int> &totals)
+{
+    TopK<K> top = {};
+
+    for (int total : totals)
+    {
+        pushTopK(top, total);
+    }
+    return sumTopK(top);
+}
+
+/**
+ * @brief Sums the K largest totals, always using the heap regardless of K.
+ * Compared against selectTopK to check where TOP_K_NETWORK_LIMIT sits.
+ *
+ * @param totals
+ * @return int
+ */
+template <size_t K>
+inline int selectTopKHeap(const std::vector<int> &totals)
+{
+    TopK<K> top = {};
+
+    for (int total : totals)
+    {
+        if (total > top.values[0])
+        {
+            insertTopKHeap(top.values, total);
+        }
+    }
+    return sumTopK(top);
+}
+
+/**
+ * @brief Benchmarks the top K selectors over the totals of a calorie list.
+ * Sizes are reported as the bytes of totals selected from.
+ *
+ * @param totals
+ * @param options
+ */
+inline void benchSelectors(const std::vector<int> &totals, const BenchOptions &options)
+{
+    size_t bytes = totals.size() * sizeof(int);
+
+    printBenchResult("checkMax/3", bytes, totals.size(), measure([&] { return selectCheckMax(totals); }, options));
+    printBenchResult("topK/3", bytes, totals.size(), measure([&] { return selectTopK<3>(totals); }, options));
+    printBenchResult("topK/16", bytes, totals.size(), measure([&] { return selectTopK<16>(totals); }, options));
+    printBenchResult("topK/16/heap", bytes, totals.size(), measure([&] { return selectTopKHeap<16>(totals); }, options));
+    printBenchResult("topK/256", bytes, totals.size(), measure([&] { return selectTopK<256>(totals); }, options));
+    printBenchResult("topK/4096", bytes, totals.size(), measure([&] { return selectTopK<4096>(totals); }, options));
+
+    // The online leaderboard, answering after every group as a live feed would
+    printBenchResult("leaderboard/3", bytes, totals.size(), measure([&] {
+        CalorieLeaderboard<TOP_SIZE> board = {};
+        int64_t answers = 0;
+
+        for (int total : totals)
+        {
+            addLeaderboardItem(board, total);
+            endLeaderboardGroup(board);
+            answers += leaderboardTopSum(board);
+        }
+        return answers;
+    }, options));
+}
+
+/**
+ * @brief Benchmarks answering several queries about an input, once with a pass per query and once fused into a single pass.
+ *
+ * @param view
+ * @param items
+ * @param options
+ */
+inline void benchQueries(InputView view, size_t items, const BenchOptions &options)
+{
+    printBenchResult("separate/2", view.length, items, measure([&] {
+        return partOne(view) + partTwo(view);
+    }, options));
+    printBenchResult("fused/2", view.length, items, measure([&] {
+        MaxQuery<> max = {};
+        TopK<TOP_SIZE> top = {};
+        runCalorieQueries(view, max, top);
+        return max.value + sumTopK(top);
+    }, options));
+    printBenchResult("separate/6", view.length, items, measure([&] {
+        MaxQuery<> max = {};
+        TopK<TOP_SIZE> top = {};
+        SumQuery sum = {};
+        CountQuery count = {};
+        MeanQuery mean = {};
+        HistogramQuery<16> histogram = {10000, {}};
+        runCalorieQueries(view, max);
+        runCalorieQueries(view, top);
+        runCalorieQueries(view, sum);
+        runCalorieQueries(view, count);
+        runCalorieQueries(view, mean);
+        runCalorieQueries(view, histogram);
+        return max.value + sumTopK(top) + sum.value + count.value + (int64_t)meanOf(mean) + histogram.counts[0];
+    }, options));
+    printBenchResult("fused/6", view.length, items, measure([&] {
+        MaxQuery<> max = {};
+        TopK<TOP_SIZE> top = {};
+        SumQuery sum = {};
+        CountQuery count = {};
+        MeanQuery mean = {};
+        HistogramQuery<16> histogram = {10000, {}};
+        runCalorieQueries(view, max, top, sum, count, mean, histogram);
+        return max.value + sumTopK(top) + sum.value + count.value + (int64_t)meanOf(mean) + histogram.counts[0];
+    }, options));
+    printBenchResult("fused/6/int64", view.length, items, measure([&] {
+        MaxQuery<int64_t> max = {};
+        TopK<TOP_SIZE, int64_t> top = {};
+        SumQuery sum = {};
+        CountQuery count = {};
+        MeanQuery mean = {};
+        HistogramQuery<16, int64_t> histogram = {10000, {}};
+        runCalorieQueries<int64_t>(view, max, top, sum, count, mean, histogram);
+        return max.value + sumTopK(top) + sum.value + (int64_t)count.value + (int64_t)meanOf(mean) + (int64_t)histogram.counts[0];
+    }, options));
+}
+
+/**
+ * @brief Benchmarks the multi-threaded reduction, doubling the threads up to the number of cores.
+ * Followed by a single thread with 64 bit totals, and the dual core reduction running on the host's stand-in for core 1.
+ *
+ * @param view
+ * @param items
+ * @param options
+ */
+inline void benchParallel(InputView view, size_t items, const BenchOptions &options)
+{
+    unsigned cores = std::max(1u, std::thread::hardware_concurrency());
+    char name[32];
+
+    for (unsigned threads = 1; threads <= cores; threads *= 2)
+    {
+        snprintf(name, sizeof(name), "parallel/%u", threads);
+        printBenchResult(name, view.length, items, measure([&] {
+            return sumTopK(reduceCaloriesParallel<TOP_SIZE>(view, threads));
+        }, options));
+    }
+
+    printBenchResult("parallel/1/i64", view.length, items, measure([&] {
+        return sumTopK(reduceCaloriesParallel<TOP_SIZE, int64_t>(view, 1));
+    }, options));
+    printBenchResult("dualcore", view.length, items, measure([&] {
+        return sumTopK(reduceCaloriesDualCore<TOP_SIZE>(view));
+    }, options));
+}
+
+/**
+ * @brief Benchmarks sorting the totals of a calorie list with the radix sort against std::sort,
+ * then building a full ranking straight from the input.
+ *
+ * @param view
+ * @param totals
+ * @param options
+ */
+inline void benchRanking(InputView view, const std::vector<int> &totals, const BenchOptions &options)
+{
+    size_t bytes = totals.size() * sizeof(int);
+    std::vector<uint32_t> keys(totals.size()), indices(totals.size()), keyScratch(totals.size()), indexScratch(totals.size());
+
+    printBenchResult("sort/std", bytes, totals.size(), measure([&] {
+        keys.assign(totals.begin(), totals.end());
+        std::sort(keys.begin(), keys.end());
+        return keys[0];
+    }, options));
+    printBenchResult("sort/radix", bytes, totals.size(), measure([&] {
+        keys.assign(totals.begin(), totals.end());
+        for (size_t i = 0; i < indices.size(); i++)
+        {
+            indices[i] = (uint32_t)i;
+        }
+        radixSortTotals(keys.data(), indices.data(), keys.size(), keyScratch.data(), indexScratch.data());
+        return keys[0];
+    }, options));
+    printBenchResult("ranking/build", view.length, totals.size(), measure([&] {
+        CalorieRanking ranking = buildCalorieRanking(view);
+        uint32_t median = totalAtPercentile(&ranking, 50);
+        freeCalorieRanking(&ranking);
+        return median;
+    }, options));
+}
+
+/**
+ * @brief Benchmarks both parts of Day 1 over generated inputs, once per supported kernel.
+ * Then benchmarks fused queries and the multi-threaded reduction with the detected kernel, and the top K selectors
+ * and sorts alone over the totals of each input.
+ * Inputs are seeded calorie lists of 1 to 15 items per elf.
+ */
+int main(int argc, char *argv[])
+{
+    BenchOptions options = parseBenchOptions(argc, argv);
+    char name[32];
+
+    printBenchHeader("Day 1");
+
+    for (size_t bytes = options.minBytes; bytes <= options.maxBytes; bytes *= options.step)
+    {
+        std::string input = generateCalories(options.seed, bytes);
+        InputView view = {input.data(), input.size()};
+        size_t items = countLines(input);
+
+        for (int kernel = 0; kernel < CALORIE_KERNEL_SIZE; kernel++)
+        {
+            if (!calorieKernelSupported((CalorieKernel)kernel))
+            {
+                continue;
+            }
+            calorieKernel = (CalorieKernel)kernel;
+
+            snprintf(name, sizeof(name), "partOne/%s", CALORIE_KERNEL_NAMES[kernel]);
+            printBenchResult(name, input.size(), items,
+                             measure([&] { return partOne(view); }, options));
+            snprintf(name, sizeof(name), "partTwo/%s", CALORIE_KERNEL_NAMES[kernel]);
+            printBenchResult(name, input.size(), items,
+                             measure([&] { return partTwo(view); }, options));
+        }
+
+        calorieKernel = detectKernel(CALORIE_KERNEL_SIZE, calorieKernelSupported);
+        benchQueries(view, items, options);
+        benchParallel(view, items, options);
+
+        std::vector<int> totals;
+        parseCalorieGroups(view.data, view.data + view.length, [&](int current) {
+            totals.push_back(current);
+        });
+        benchSelectors(totals, options);
+        benchRanking(view, totals, options);
+    }
+}
@@ -0,0 +1,145 @@
+#define AOC_NO_MAIN
+#include "day2.cpp"
+#include "histogram.h"
+#include "game.h"
+#include "parallel.h"
+#include "bench.h"
+#include "generators.h"
+
+/**
+ * @brief Checks the histogram of some rounds against the pair tables, with the kernel currently selected
+ *
+ * @param name Name of the input, for reporting
+ * @param input
+ * @return true
+ * @return false If either part differs
+ */
+bool checkHistogram(const char *name, PackedRounds input)
+{
+    RoundHistogram histogram = countRounds(input);
+    uint64_t one = scoreRoundHistogram(histogram, PART_ONE_SCORES), two = scoreRoundHistogram(histogram, PART_TWO_SCORES);
+    uint64_t expectedOne = scorePackedPairs<uint64_t>(input, PART_ONE_SCORES);
+    uint64_t expectedTwo = scorePackedPairs<uint64_t>(input, PART_TWO_SCORES);
+
+    if (one != expectedOne || two != expectedTwo)
+    {
+        printf("Mismatch in histogram of %s: %llu/%llu, expected %llu/%llu\n", name,
+               (unsigned long long)one, (unsigned long long)two,
+               (unsigned long long)expectedOne, (unsigned long long)expectedTwo);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Benchmarks histogram scoring with every counting kernel the processor supports.
+ * Each kernel is first checked against the pair tables, on the generated rounds and on rounds that are
+ * all the same, which fills the byte counters as fast as possible.
+ *
+ * @param input
+ * @param bytes
+ * @param options
+ * @return true
+ * @return false If a kernel gave a wrong answer
+ */
+bool benchHistogram(PackedRounds input, size_t bytes, const BenchOptions &options)
+{
+    // Every round "A X", the nibble 0
+    std::vector<uint32_t> same(PACKED_WORDS(input.rounds), 0);
+    PackedRounds sameInput = {same.data(), input.rounds};
+    bool passed = true;
+
+    const char *kernelNames[] = {ROUND_VECTOR_COUNTING ? "sse2" : "scalar", "avx2"};
+    int kernels = 1;
+    char name[32];
+
+#if ROUND_VECTOR_COUNTING
+    kernels += cpuSupportsAvx2() ? 1 : 0;
+#endif
+
+    for (int kernel = 0; kernel < kernels; kernel++)
+    {
+#if ROUND_VECTOR_COUNTING
+        roundCountingAvx2 = kernel == 1;
+#endif
+        snprintf(name, sizeof(name), "histogram/%s", kernelNames[kernel]);
+        passed &= checkHistogram("generated rounds", input) && checkHistogram("identical rounds", sameInput);
+        printBenchResult(name, bytes, input.rounds,
+                         measure([&] {
+                             RoundHistogram histogram = countRounds(input);
+                             return scoreRoundHistogram(histogram, PART_ONE_SCORES) +
+                                    scoreRoundHistogram(histogram, PART_TWO_SCORES);
+                         }, options));
+    }
+
+#if ROUND_VECTOR_COUNTING
+    roundCountingAvx2 = cpuSupportsAvx2();
+#endif
+    return passed;
+}
+
+/**
+ * @brief Benchmarks both parts of Day 2 over generated inputs.
+ * Inputs are seeded rounds in the encoded form, two uint32_t values per round,
+ * which the packed solvers take packed into nibbles.
+ */
+int main(int argc, char *argv[])
+{
+    BenchOptions options = parseBenchOptions(argc, argv);
+
+    printBenchHeader("Day 2");
+
+    // Rock Paper Scissors Lizard Spock, with the responses asking for a loss, draw or win
+    const int32_t outcomePayoffs[] = {LOSS, DRAW, WIN};
+    GameRules rules = {};
+    GameStrategy strategy = {};
+    GameTable gameTable = {}, strategyTable = {};
+
+    if (!makeCyclicGame(5, rules) || !deriveGameStrategy(rules, outcomePayoffs, 3, strategy) ||
+        !compileGameTable(rules, gameTable) || !compileStrategyTable(rules, strategy, strategyTable))
+    {
+        printf("Unable to compile the game tables\n");
+        return 1;
+    }
+
+    bool failed = false;
+
+    for (size_t bytes = options.minBytes; bytes <= options.maxBytes; bytes *= options.step)
+    {
+        size_t rounds = bytes / (2 * sizeof(uint32_t));
+        std::vector<uint32_t> input = generateRounds(options.seed, rounds);
+        std::string text = generateRoundsText(options.seed, rounds);
+        std::vector<uint32_t> packed(PACKED_WORDS(rounds));
+        packRoundsInto(input.data(), input.size(), packed.data());
+        PackedRounds packedInput = {packed.data(), rounds};
+        std::vector<uint8_t> gameInput = generateGameRounds(options.seed, rounds, 5, 5);
+        std::vector<uint8_t> strategyInput = generateGameRounds(options.seed, rounds, 5, 3);
+
+        printBenchResult("partOne", bytes, rounds,
+                         measure([&] { return partOne(input.data(), input.size()); }, options));
+        printBenchResult("partTwo", bytes, rounds,
+                         measure([&] { return partTwo(input.data(), input.size()); }, options));
+        printBenchResult("partOne/nibble", bytes, rounds,
+                         measure([&] { return scorePackedRounds(packedInput, scoreRoundOne); }, options));
+        printBenchResult("partTwo/nibble", bytes, rounds,
+                         measure([&] { return scorePackedRounds(packedInput, scoreRoundTwo); }, options));
+        printBenchResult("partOne/packed", bytes, rounds,
+                         measure([&] { return partOnePacked(packedInput); }, options));
+        printBenchResult("partTwo/packed", bytes, rounds,
+                         measure([&] { return partTwoPacked(packedInput); }, options));
+        printBenchResult("partOne/parallel", bytes, rounds,
+                         measure([&] { return scoreRoundsParallel(packedInput, PART_ONE_SCORES); }, options));
+        printBenchResult("text/pack", bytes, rounds,
+                         measure([&] {
+                             packTextRoundsInto({text.data(), text.size()}, packed.data());
+                             return packed[0];
+                         }, options));
+        failed |= !benchHistogram(packedInput, bytes, options);
+        printBenchResult("game/rpsls", bytes, rounds,
+                         measure([&] { return scoreGameRounds(gameInput.data(), rounds, gameTable); }, options));
+        printBenchResult("game/strategy", bytes, rounds,
+                         measure([&] { return scoreGameRounds(strategyInput.data(), rounds, strategyTable); }, options));
+    }
+
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,120 @@
+#define AOC_NO_MAIN
+#include "day3.cpp"
+#include "bench.h"
+#include "generators.h"
+
+/**
+ * @brief Builds the item sets of both halves of every rucksack, folding them into a checksum
+ *
+ * @param input
+ * @param buildSet Builds the set of items between two pointers as a 64 bit value
+ * @return uint64_t
+ */
+template <typename BuildSet>
+uint64_t buildRucksackSets(InputView input, BuildSet buildSet)
+{
+    const char *start = input.data, *last = input.data + input.length, *end = NULL;
+    uint64_t result = 0;
+
+    while (start < last)
+    {
+        end = findChar(start, last, '\n');
+        end = end == NULL ? last : end;
+
+        const char *mid = start + ((end - start) >> 1);
+        result += buildSet(start, mid) ^ buildSet(mid, end);
+        start = end + 1;
+    }
+    return result;
+}
+
+/**
+ * @brief Benchmarks both parts of Day 3 over generated inputs.
+ * Inputs are seeded rucksacks drawn from the full 52 item alphabet.
+ */
+int main(int argc, char *argv[])
+{
+    BenchOptions options = parseBenchOptions(argc, argv);
+
+    char name[32];
+
+    printBenchHeader("Day 3");
+
+    for (size_t bytes = options.minBytes; bytes <= options.maxBytes; bytes *= options.step)
+    {
+        std::string input = generateRucksacks(options.seed, bytes);
+        InputView view = {input.data(), input.size()};
+        size_t items = countLines(input);
+        std::vector<uint64_t> duplicates;
+
+        for (const char *start = view.data, *last = view.data + view.length; start < last;)
+        {
+            const char *end = findChar(start, last, '\n');
+            end = end == NULL ? last : end;
+
+            const char *mid = start + ((end - start) >> 1);
+            duplicates.push_back(calculateItemMask(start, mid) & calculateItemMask(mid, end));
+            start = end + 1;
+        }
+
+        for (int kernel = 0; kernel < ITEM_KERNEL_SIZE; kernel++)
+        {
+            if (!itemKernelSupported((ItemKernel)kernel))
+            {
+                continue;
+            }
+            itemKernel = (ItemKernel)kernel;
+
+            snprintf(name, sizeof(name), "partOne/%s", ITEM_KERNEL_NAMES[kernel]);
+            printBenchResult(name, input.size(), items,
+                             measure([&] { return partOne(view); }, options));
+            snprintf(name, sizeof(name), "partTwo/%s", ITEM_KERNEL_NAMES[kernel]);
+            printBenchResult(name, input.size(), items,
+                             measure([&] { return partTwo(view); }, options));
+        }
+
+        itemKernel = detectKernel(ITEM_KERNEL_SIZE, itemKernelSupported);
+
+        LineIndex lines = buildLineIndex(view);
+
+        printBenchResult("index/build", input.size(), items,
+                         measure([&] {
+                             LineIndex built = buildLineIndex(view);
+                             size_t count = built.count;
+                             freeLineIndex(&built);
+                             return count;
+                         }, options));
+        printBenchResult("partOne/indexed", input.size(), items,
+                         measure([&] { return partOneIndexed(&lines); }, options));
+        printBenchResult("partTwo/indexed", input.size(), items,
+                         measure([&] { return partTwoIndexed(&lines); }, options));
+        freeLineIndex(&lines);
+        printBenchResult("sets/bits", input.size(), items,
+                         measure([&] {
+                             return buildRucksackSets(view, [](const char *start, const char *end) {
+                                 CharacterBits bits = calculateBits(start, end);
+                                 return (uint64_t)bits.upper << 32 | bits.lower;
+                             });
+                         }, options));
+        printBenchResult("sets/mask", input.size(), items,
+                         measure([&] { return buildRucksackSets(view, calculateItemMask); }, options));
+        printBenchResult("priority/loop", input.size(), items,
+                         measure([&] {
+                             int result = 0;
+                             for (uint64_t duplicate : duplicates)
+                             {
+                                 result += sumBitPositions(duplicate >> 1);
+                             }
+                             return result;
+                         }, options));
+        printBenchResult("priority/bits", input.size(), items,
+                         measure([&] {
+                             int result = 0;
+                             for (uint64_t duplicate : duplicates)
+                             {
+                                 result += sumItemPriorities(duplicate);
+                             }
+                             return result;
+                         }, options));
+    }
+}
@@ -0,0 +1,27 @@
+#define AOC_NO_MAIN
+#include "day4.cpp"
+#include "bench.h"
+#include "generators.h"
+
+/**
+ * @brief Benchmarks both parts of Day 4 over generated inputs.
+ * Inputs are seeded section assignment pairs between 1 and 99.
+ */
+int main(int argc, char *argv[])
+{
+    BenchOptions options = parseBenchOptions(argc, argv);
+
+    printBenchHeader("Day 4");
+
+    for (size_t bytes = options.minBytes; bytes <= options.maxBytes; bytes *= options.step)
+    {
+        std::string input = generateRanges(options.seed, bytes);
+        InputView view = {input.data(), input.size()};
+        size_t items = countLines(input);
+
+        printBenchResult("partOne", input.size(), items,
+                         measure([&] { return partOne(view); }, options));
+        printBenchResult("partTwo", input.size(), items,
+                         measure([&] { return partTwo(view); }, options));
+    }
+}
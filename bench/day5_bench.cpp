@@ -0,0 +1,29 @@
+#define AOC_NO_MAIN
+#include "day5.cpp"
+#include "bench.h"
+#include "generators.h"
+
+/**
+ * @brief Benchmarks both parts of Day 5 over generated inputs.
+ * Inputs are a seeded drawing of 9 stacks followed by moves, matching the puzzle input.
+ */
+int main(int argc, char *argv[])
+{
+    BenchOptions options = parseBenchOptions(argc, argv);
+
+    char result[RESULT_SIZE];
+
+    printBenchHeader("Day 5");
+
+    for (size_t bytes = options.minBytes; bytes <= options.maxBytes; bytes *= options.step)
+    {
+        std::string input = generateCrates(options.seed, bytes);
+        InputView view = {input.data(), input.size()};
+        size_t items = std::count(input.begin() + input.find("\n\n") + 2, input.end(), '\n') + 1;
+
+        printBenchResult("partOne", input.size(), items,
+                         measure([&] { return partOne(view, result, RESULT_SIZE); }, options));
+        printBenchResult("partTwo", input.size(), items,
+                         measure([&] { return partTwo(view, result, RESULT_SIZE); }, options));
+    }
+}
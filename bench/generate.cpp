@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bench.h"
+#include "generators.h"
+
+/**
+ * @brief Writes a generated puzzle input to stdout
+ * Usage: generate <calories|rounds|rucksacks|ranges|crates> <bytes> [seed]
+ * Rounds are written in the raw puzzle text form.
+ */
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "Usage: %s <calories|rounds|rucksacks|ranges|crates> <bytes> [seed]\n", argv[0]);
+        return 1;
+    }
+
+    const char *format = argv[1];
+    size_t bytes = parseBytes(argv[2]);
+    uint64_t seed = argc > 3 ? strtoull(argv[3], NULL, 10) : 2022;
+    std::string input;
+
+    if (strcmp(format, "calories") == 0)
+    {
+        input = generateCalories(seed, bytes);
+    }
+    else if (strcmp(format, "rounds") == 0)
+    {
+        input = generateRoundsText(seed, (bytes + 3) / 4);
+    }
+    else if (strcmp(format, "rucksacks") == 0)
+    {
+        input = generateRucksacks(seed, bytes);
+    }
+    else if (strcmp(format, "ranges") == 0)
+    {
+        input = generateRanges(seed, bytes);
+    }
+    else if (strcmp(format, "crates") == 0)
+    {
+        input = generateCrates(seed, bytes);
+    }
+    else
+    {
+        fprintf(stderr, "Unknown format %s\n", format);
+        return 1;
+    }
+
+    fwrite(input.data(), 1, input.size(), stdout);
+    return 0;
+}
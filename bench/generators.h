@@ -0,0 +1,404 @@
+#ifndef GENERATORS_H
+#define GENERATORS_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/*
+    Seeded generators for each day's puzzle format.
+    Every generator is deterministic for a given seed, so scaling and regression runs can be
+    reproduced from the seed and size alone instead of storing large inputs in the repo.
+    Generated inputs follow the same layout as the puzzle inputs in each dayN.h, without a
+    trailing newline, and keep to the puzzle contracts the solvers rely on.
+*/
+
+/**
+ * @brief State for a SplitMix64 generator
+ */
+typedef struct
+{
+    uint64_t state;
+} Random;
+
+/**
+ * @brief Returns the next 64 random bits
+ *
+ * @param random
+ * @return uint64_t
+ */
+inline uint64_t nextRandom(Random *random)
+{
+    uint64_t value = (random->state += 0x9E3779B97F4A7C15ull);
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Returns a random value between low and high inclusive
+ *
+ * @param random
+ * @param low
+ * @param high
+ * @return uint32_t
+ */
+inline uint32_t randomBetween(Random *random, uint32_t low, uint32_t high)
+{
+    return low + (uint32_t)(((nextRandom(random) >> 32) * (uint64_t)(high - low + 1)) >> 32);
+}
+
+/**
+ * @brief Generates a Day 1 calorie list of at least the requested size
+ * Each elf carries between 1 and maxItems items of 1 to maxCalories calories,
+ * with a blank line between elves.
+ *
+ * @param seed
+ * @param bytes
+ * @param maxItems
+ * @param maxCalories
+ * @return std::string
+ */
+inline std::string generateCalories(uint64_t seed, size_t bytes, uint32_t maxItems = 15, uint32_t maxCalories = 60000)
+{
+    Random random{seed};
+    std::string result;
+    char buffer[16];
+
+    result.reserve(bytes + 16 * maxItems);
+
+    while (result.size() < bytes)
+    {
+        uint32_t items = randomBetween(&random, 1, maxItems);
+
+        if (!result.empty())
+        {
+            result += '\n';
+        }
+
+        for (uint32_t i = 0; i < items; i++)
+        {
+            int length = snprintf(buffer, sizeof(buffer), "%s%u",
+                                  i == 0 ? "" : "\n", randomBetween(&random, 1, maxCalories));
+            result.append(buffer, length);
+        }
+
+        if (result.size() < bytes)
+        {
+            result += '\n';
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Generates Day 2 rounds in the encoded form used by day2.h
+ * Each round is an opponent move (A, B, C) followed by a response (X, Y, Z).
+ *
+ * @param seed
+ * @param rounds
+ * @return std::vector<uint32_t>
+ */
+inline std::vector<uint32_t> generateRounds(uint64_t seed, size_t rounds)
+{
+    Random random{seed};
+    std::vector<uint32_t> result(rounds * 2);
+
+    for (size_t i = 0; i < result.size(); i++)
+    {
+        result[i] = randomBetween(&random, 0, 2);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Generates rounds of a game with any number of moves, a byte per round as packed by packGameRound
+ *
+ * @param seed
+ * @param rounds
+ * @param moves
+ * @param responses Number of moves, or of outcomes, the response is picked from
+ * @return std::vector<uint8_t>
+ */
+inline std::vector<uint8_t> generateGameRounds(uint64_t seed, size_t rounds, uint32_t moves, uint32_t responses)
+{
+    Random random{seed};
+    std::vector<uint8_t> result(rounds);
+
+    for (size_t i = 0; i < rounds; i++)
+    {
+        uint32_t opponent = randomBetween(&random, 0, moves - 1);
+        result[i] = (uint8_t)(opponent << 4 | randomBetween(&random, 0, responses - 1));
+    }
+
+    return result;
+}
+
+/**
+ * @brief Generates Day 2 rounds in the raw puzzle text form, one "A Y" per line
+ * Uses the same sequence as generateRounds for the same seed.
+ *
+ * @param seed
+ * @param rounds
+ * @return std::string
+ */
+inline std::string generateRoundsText(uint64_t seed, size_t rounds)
+{
+    std::vector<uint32_t> encoded = generateRounds(seed, rounds);
+    std::string result(rounds * 4 - (rounds > 0), '\n');
+
+    for (size_t i = 0; i < rounds; i++)
+    {
+        result[i * 4] = 'A' + encoded[i * 2];
+        result[i * 4 + 1] = ' ';
+        result[i * 4 + 2] = 'X' + encoded[i * 2 + 1];
+    }
+
+    return result;
+}
+
+/**
+ * @brief Returns the item character for a priority, 1-26 are a-z and 27-52 are A-Z
+ *
+ * @param priority
+ * @return char
+ */
+inline char itemForPriority(uint32_t priority)
+{
+    return priority <= 26 ? 'a' + priority - 1 : 'A' + priority - 27;
+}
+
+/**
+ * @brief Appends a compartment of random items from a pool, with the required items at random positions
+ *
+ * @param random
+ * @param line
+ * @param length
+ * @param pool
+ * @param required
+ */
+inline void fillCompartment(Random *random, std::string &line, uint32_t length,
+                            const std::vector<char> &pool, const std::vector<char> &required)
+{
+    std::string compartment(required.begin(), required.end());
+
+    while (compartment.size() < length)
+    {
+        compartment += pool.empty() ? required[0] : pool[randomBetween(random, 0, pool.size() - 1)];
+    }
+
+    for (size_t i = compartment.size() - 1; i > 0; i--)
+    {
+        std::swap(compartment[i], compartment[randomBetween(random, 0, i)]);
+    }
+
+    line += compartment;
+}
+
+/**
+ * @brief Generates Day 3 rucksacks of at least the requested size
+ * The puzzle contracts are kept: the two compartments of a rucksack share exactly one item,
+ * and each group of three rucksacks shares exactly one badge item, so the output always
+ * contains a multiple of three lines.
+ * Items are drawn from the first alphabetWidth priorities, which must be at least 7.
+ * Each group gives its three rucksacks disjoint item sets plus the badge, and each rucksack
+ * splits its set between compartments except for its duplicate.
+ *
+ * @param seed
+ * @param bytes
+ * @param alphabetWidth
+ * @param maxCompartment
+ * @return std::string
+ */
+inline std::string generateRucksacks(uint64_t seed, size_t bytes, uint32_t alphabetWidth = 52, uint32_t maxCompartment = 16)
+{
+    Random random{seed};
+    std::string result;
+    std::vector<char> alphabet;
+
+    alphabetWidth = std::min(std::max(alphabetWidth, 7u), 52u);
+    maxCompartment = std::max(maxCompartment, 2u);
+
+    for (uint32_t priority = 1; priority <= alphabetWidth; priority++)
+    {
+        alphabet.push_back(itemForPriority(priority));
+    }
+
+    result.reserve(bytes + 6 * maxCompartment + 3);
+
+    while (result.size() < bytes)
+    {
+        // Shuffle so the badge is first, followed by three disjoint slices
+        for (size_t i = alphabet.size() - 1; i > 0; i--)
+        {
+            std::swap(alphabet[i], alphabet[randomBetween(&random, 0, i)]);
+        }
+
+        char badge = alphabet[0];
+        size_t slice = (alphabet.size() - 1) / 3;
+
+        for (size_t elf = 0; elf < 3; elf++)
+        {
+            std::vector<char> pool(alphabet.begin() + 1 + elf * slice, alphabet.begin() + 1 + (elf + 1) * slice);
+            pool.push_back(badge);
+
+            for (size_t i = pool.size() - 1; i > 0; i--)
+            {
+                std::swap(pool[i], pool[randomBetween(&random, 0, i)]);
+            }
+
+            char duplicate = pool[0];
+            std::vector<char> first, second, firstRequired{duplicate}, secondRequired{duplicate};
+
+            for (size_t i = 1; i < pool.size(); i++)
+            {
+                (i & 1 ? first : second).push_back(pool[i]);
+            }
+
+            // The badge needs to appear in the rucksack even when it isn't the duplicate
+            if (duplicate != badge)
+            {
+                (std::find(first.begin(), first.end(), badge) != first.end() ? firstRequired : secondRequired).push_back(badge);
+            }
+
+            uint32_t length = randomBetween(&random, 2, maxCompartment);
+
+            if (!result.empty())
+            {
+                result += '\n';
+            }
+            fillCompartment(&random, result, length, first, firstRequired);
+            fillCompartment(&random, result, length, second, secondRequired);
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Generates Day 4 section assignment pairs of at least the requested size
+ * Each line is two ranges "a-b,c-d" with sections between 1 and maxSection.
+ *
+ * @param seed
+ * @param bytes
+ * @param maxSection
+ * @return std::string
+ */
+inline std::string generateRanges(uint64_t seed, size_t bytes, uint32_t maxSection = 99)
+{
+    Random random{seed};
+    std::string result;
+    char buffer[64];
+
+    result.reserve(bytes + sizeof(buffer));
+
+    while (result.size() < bytes)
+    {
+        uint32_t firstLower = randomBetween(&random, 1, maxSection);
+        uint32_t firstUpper = randomBetween(&random, firstLower, maxSection);
+        uint32_t secondLower = randomBetween(&random, 1, maxSection);
+        uint32_t secondUpper = randomBetween(&random, secondLower, maxSection);
+
+        int length = snprintf(buffer, sizeof(buffer), "%s%u-%u,%u-%u", result.empty() ? "" : "\n",
+                              firstLower, firstUpper, secondLower, secondUpper);
+        result.append(buffer, length);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Generates a Day 5 crate drawing followed by moves, of at least the requested size
+ * The drawing has the given number of stacks (up to 999) with up to maxHeight crates each.
+ * Moves are simulated against the stack heights so they never take more crates than a stack holds.
+ *
+ * @param seed
+ * @param bytes
+ * @param stacks
+ * @param maxHeight
+ * @param maxCount
+ * @return std::string
+ */
+inline std::string generateCrates(uint64_t seed, size_t bytes, uint32_t stacks = 9, uint32_t maxHeight = 8, uint32_t maxCount = 20)
+{
+    Random random{seed};
+    std::string result;
+    std::vector<uint32_t> heights(std::min(std::max(stacks, 2u), 999u));
+    char buffer[64];
+
+    uint32_t total = 0, tallest = 0;
+
+    for (uint32_t &height : heights)
+    {
+        height = randomBetween(&random, 0, maxHeight);
+        total += height;
+        tallest = std::max(tallest, height);
+    }
+
+    // Make sure there is always a crate to move
+    if (total == 0)
+    {
+        heights[0] = tallest = total = 1;
+    }
+
+    // The drawing is written from the top row down
+    for (uint32_t row = tallest; row > 0; row--)
+    {
+        for (size_t column = 0; column < heights.size(); column++)
+        {
+            if (heights[column] >= row)
+            {
+                result += '[';
+                result += (char)('A' + randomBetween(&random, 0, 25));
+                result += ']';
+            }
+            else
+            {
+                result += "   ";
+            }
+            result += column + 1 < heights.size() ? ' ' : '\n';
+        }
+    }
+
+    for (size_t column = 0; column < heights.size(); column++)
+    {
+        snprintf(buffer, sizeof(buffer), column + 1 < 10 ? " %zu  " : column + 1 < 100 ? " %zu " : "%zu ", column + 1);
+        result += buffer;
+    }
+    result.back() = '\n';
+    result += '\n';
+
+    size_t start = result.size();
+    result.reserve(bytes + sizeof(buffer));
+
+    while (result.size() < bytes || result.size() == start)
+    {
+        uint32_t from, to;
+
+        do
+        {
+            from = randomBetween(&random, 0, heights.size() - 1);
+        } while (heights[from] == 0);
+
+        do
+        {
+            to = randomBetween(&random, 0, heights.size() - 1);
+        } while (to == from);
+
+        uint32_t count = randomBetween(&random, 1, std::min(heights[from], maxCount));
+        heights[from] -= count;
+        heights[to] += count;
+
+        int length = snprintf(buffer, sizeof(buffer), "%smove %u from %u to %u",
+                              result.size() == start ? "" : "\n", count, from + 1, to + 1);
+        result.append(buffer, length);
+    }
+
+    return result;
+}
+
+#endif /* GENERATORS_H */
@@ -0,0 +1,89 @@
+#ifndef COMMON_ANSWER
+#define COMMON_ANSWER
+
+#include <stdio.h>
+#include <stdint.h>
+#include "pico/stdlib.h"
+
+/*
+    Answers for the embedded inputs.
+    With AOC_FOLD_ANSWERS the compiler solves each embedded input and the binary only carries the
+    answers as constants, so they are available the moment the board boots. AOC_VERIFY_ANSWERS
+    additionally runs the runtime solver, checks it against the folded answer and reports how long it took.
+*/
+
+#ifndef AOC_FOLD_ANSWERS
+#define AOC_FOLD_ANSWERS 0
+#endif
+
+#ifndef AOC_VERIFY_ANSWERS
+#define AOC_VERIFY_ANSWERS 0
+#endif
+
+/**
+ * @brief Forces an answer to be computed at compile time
+ * 
+ * @tparam Answer 
+ * @return int 
+ */
+template <int Answer>
+constexpr int foldAnswer()
+{
+    return Answer;
+}
+
+/**
+ * @brief Stops the compiler from assuming it knows a value.
+ * The embedded inputs are constants, without this the optimizer is free to solve the runtime path at compile time too.
+ * 
+ * @param value 
+ */
+template <typename T>
+inline void hideValue(T &value)
+{
+    asm volatile("" : : "r"(&value) : "memory");
+}
+
+/**
+ * @brief Runs a solver at runtime and checks it against the folded answer when verification is enabled
+ * 
+ * @param answer The folded answer
+ * @param solver 
+ * @param name Name of the solver, for reporting
+ * @param args Input for the solver
+ * @return int The folded answer
+ */
+template <typename Solver, typename... Args>
+inline int verifyAnswer(int answer, Solver solver, const char *name, Args... args)
+{
+#if AOC_VERIFY_ANSWERS
+    (hideValue(args), ...);
+
+    uint64_t start = time_us_64();
+    int result = solver(args...);
+    uint64_t elapsed = time_us_64() - start;
+
+    if (result == answer)
+    {
+        printf("Verified %s in %llu us\n", name, (unsigned long long)elapsed);
+    }
+    else
+    {
+        printf("Mismatch in %s: runtime %d, folded %d\n", name, result, answer);
+    }
+#endif
+    return answer;
+}
+
+/**
+ * @brief Solves an embedded input, the arguments must be constant expressions.
+ * Folds the answer into the binary with AOC_FOLD_ANSWERS, otherwise calls the solver at runtime.
+ */
+#if AOC_FOLD_ANSWERS
+#define AOC_ANSWER(solver, ...) \
+    verifyAnswer(foldAnswer<solver(__VA_ARGS__)>(), solver, #solver, __VA_ARGS__)
+#else
+#define AOC_ANSWER(solver, ...) solver(__VA_ARGS__)
+#endif
+
+#endif /* COMMON_ANSWER */
@@ -0,0 +1,98 @@
+#ifndef COMMON_BITS
+#define COMMON_BITS
+
+#include <stdint.h>
+
+/*
+    Bit counting.
+    Counting trailing zeros and set bits are single instructions on the host and on most ARM cores,
+    which the compiler builtins map to. The Cortex-M0+ in the RP2040 has neither, and the builtins
+    fall back to generic library loops there, so it uses the portable versions below instead:
+    a de Bruijn multiply for trailing zeros, and a SWAR sum for set bits. Both only need a 32 bit
+    multiply, which the RP2040 does in a single cycle.
+*/
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__ARM_ARCH_6M__)
+#define BITS_BUILTINS 1
+#else
+#define BITS_BUILTINS 0
+#endif
+
+/**
+ * @brief Multiplying the lowest set bit by this puts a unique 5 bit pattern in the top bits
+ */
+#define BITS_DE_BRUIJN 0x077CB531u
+
+/**
+ * @brief The position of the lowest set bit for each pattern of BITS_DE_BRUIJN
+ */
+constexpr uint8_t BITS_DE_BRUIJN_POSITIONS[32] = {
+    0, 1, 28, 2, 29, 14, 24, 3, 30, 22, 20, 15, 25, 17, 4, 8,
+    31, 27, 13, 23, 21, 19, 16, 7, 26, 12, 18, 6, 11, 5, 10, 9};
+
+/**
+ * @brief Counts the trailing zeros of a value without any special instructions
+ *
+ * @param value Must not be 0
+ * @return int
+ */
+constexpr int countTrailingZerosPortable(uint64_t value)
+{
+    uint32_t low = (uint32_t)value;
+    uint32_t word = low != 0 ? low : (uint32_t)(value >> 32);
+
+    return (low != 0 ? 0 : 32) + BITS_DE_BRUIJN_POSITIONS[((word & (0u - word)) * BITS_DE_BRUIJN) >> 27];
+}
+
+/**
+ * @brief Counts the set bits of a value without any special instructions
+ *
+ * @param value
+ * @return int
+ */
+constexpr int popCountPortable(uint64_t value)
+{
+    uint32_t halves[2] = {(uint32_t)value, (uint32_t)(value >> 32)};
+    int result = 0;
+
+    for (uint32_t half : halves)
+    {
+        half = half - ((half >> 1) & 0x55555555u);
+        half = (half & 0x33333333u) + ((half >> 2) & 0x33333333u);
+        half = (half + (half >> 4)) & 0x0F0F0F0Fu;
+        result += (int)((half * 0x01010101u) >> 24);
+    }
+    return result;
+}
+
+/**
+ * @brief Counts the trailing zeros of a value
+ *
+ * @param value Must not be 0
+ * @return int
+ */
+constexpr int countTrailingZeros(uint64_t value)
+{
+#if BITS_BUILTINS
+    return __builtin_ctzll(value);
+#else
+    return countTrailingZerosPortable(value);
+#endif
+}
+
+/**
+ * @brief Counts the set bits of a value
+ *
+ * @param value
+ * @return int
+ */
+constexpr int popCount(uint64_t value)
+{
+#if BITS_BUILTINS
+    return __builtin_popcountll(value);
+#else
+    return popCountPortable(value);
+#endif
+}
+
+#endif /* COMMON_BITS */
@@ -0,0 +1,21 @@
+#ifndef COMMON_CONSTANT
+#define COMMON_CONSTANT
+
+/**
+ * @brief Whether the caller is being evaluated by the compiler as part of a constant expression.
+ * Lets constexpr solvers keep their fast runtime paths (memchr, intrinsics, kernel dispatch),
+ * which can't be evaluated by the compiler, and fall back to plain loops at compile time.
+ * 
+ * @return true 
+ * @return false 
+ */
+constexpr bool isConstantEvaluated()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+#endif /* COMMON_CONSTANT */
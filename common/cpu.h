@@ -0,0 +1,46 @@
+#ifndef COMMON_CPU
+#define COMMON_CPU
+
+/*
+    Processor features.
+    Vector kernels are compiled for every x86-64 host, and picked at runtime from what the processor
+    supports. Kernels are listed in an enum from slowest to fastest, with a portable kernel that always
+    runs first, so picking one is walking down from the fastest until one is supported.
+*/
+
+/**
+ * @brief Whether the processor supports AVX2, always false on anything but x86-64
+ * 
+ * @return true 
+ * @return false 
+ */
+inline bool cpuSupportsAvx2()
+{
+#if defined(__x86_64__)
+    return __builtin_cpu_supports("avx2");
+#else
+    return false;
+#endif
+}
+
+/**
+ * @brief Picks the fastest of a list of kernels the processor supports
+ * 
+ * @tparam Kernel An enum of kernels, ordered from slowest to fastest, the first of which is always supported
+ * @param count Number of kernels
+ * @param supported Checks whether a kernel can run on this processor
+ * @return Kernel 
+ */
+template <typename Kernel>
+inline Kernel detectKernel(int count, bool (*supported)(Kernel))
+{
+    int kernel = count - 1;
+
+    while (kernel > 0 && !supported((Kernel)kernel))
+    {
+        kernel--;
+    }
+    return (Kernel)kernel;
+}
+
+#endif /* COMMON_CPU */
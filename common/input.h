@@ -0,0 +1,259 @@
+#ifndef COMMON_INPUT
+#define COMMON_INPUT
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
+#include "constant.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define INPUT_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define INPUT_MMAP 0
+#endif
+
+/**
+ * @brief A puzzle input along with its length.
+ * Solvers take a view instead of a NUL terminated string so they never need to scan
+ * the input to find its end. The data is not owned by the view.
+ */
+typedef struct
+{
+    const char *data;
+    size_t length;
+} InputView;
+
+/**
+ * @brief Creates a view over a string literal, with the length known at compile time
+ * 
+ * @tparam N Size of the literal including its terminator
+ * @param input 
+ * @return InputView 
+ */
+template <size_t N>
+constexpr InputView inputView(const char (&input)[N])
+{
+    return {input, N - 1};
+}
+
+/**
+ * @brief Finds the first occurrence of value between start and end.
+ * Uses memchr at runtime, and a plain loop when evaluated by the compiler.
+ * 
+ * @param start 
+ * @param end 
+ * @param value 
+ * @return const char* NULL when value isn't found
+ */
+constexpr const char *findChar(const char *start, const char *end, char value)
+{
+    if (!isConstantEvaluated())
+    {
+        return (const char *)memchr(start, value, end - start);
+    }
+
+    for (; start < end; start++)
+    {
+        if (*start == value)
+        {
+            return start;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Reads a stream to its end into a buffer owned by the caller.
+ * The buffer grows as the stream is read, so the length is known without scanning the data again.
+ * The buffer is NUL terminated for convenience and must be released with freeInput.
+ * 
+ * @param stream 
+ * @return InputView An empty view if the stream couldn't be read
+ */
+inline InputView readInput(FILE *stream)
+{
+    size_t capacity = 1 << 16, length = 0, read;
+    char *buffer = (char *)malloc(capacity + 1);
+
+    while (buffer != NULL && (read = fread(buffer + length, 1, capacity - length, stream)) > 0)
+    {
+        length += read;
+        if (length == capacity)
+        {
+            capacity *= 2;
+            char *grown = (char *)realloc(buffer, capacity + 1);
+            if (grown == NULL)
+            {
+                free(buffer);
+            }
+            buffer = grown;
+        }
+    }
+
+    if (buffer == NULL)
+    {
+        return {NULL, 0};
+    }
+
+    buffer[length] = '\0';
+    return {buffer, length};
+}
+
+/**
+ * @brief Reads a file into a buffer owned by the caller, see readInput
+ * 
+ * @param path 
+ * @return InputView An empty view if the file couldn't be read
+ */
+inline InputView readInputFile(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+
+    if (file == NULL)
+    {
+        return {NULL, 0};
+    }
+
+    InputView input = readInput(file);
+    fclose(file);
+    return input;
+}
+
+/**
+ * @brief Reads the input named on the command line, where "-" reads from stdin.
+ * Trailing newlines are trimmed so runtime inputs end the same way as the embedded ones.
+ * 
+ * @param path 
+ * @return InputView An empty view if the input couldn't be read, release it with freeInput
+ */
+inline InputView readInputArgument(const char *path)
+{
+    InputView input = path[0] == '-' && path[1] == '\0' ? readInput(stdin) : readInputFile(path);
+
+    while (input.length > 0 && input.data[input.length - 1] == '\n')
+    {
+        input.length--;
+    }
+
+    return input;
+}
+
+#if INPUT_MMAP
+/**
+ * @brief Maps a file into memory rather than reading it, on hosts with mmap.
+ * Pages are only read from disk as the solver reaches them, so inputs larger than memory can be solved
+ * without copying them. Unlike readInputArgument, trailing newlines are kept and the data isn't NUL terminated.
+ * 
+ * @param path 
+ * @return InputView An empty view if the file couldn't be mapped, release it with unmapInput
+ */
+inline InputView mapInputFile(const char *path)
+{
+    static const char empty[] = "";
+    int file = open(path, O_RDONLY);
+    struct stat status;
+
+    if (file < 0)
+    {
+        return {NULL, 0};
+    }
+
+    if (fstat(file, &status) != 0)
+    {
+        close(file);
+        return {NULL, 0};
+    }
+
+    if (status.st_size == 0)
+    {
+        close(file);
+        return {empty, 0};
+    }
+
+    void *data = mmap(NULL, status.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+
+    if (data == MAP_FAILED)
+    {
+        return {NULL, 0};
+    }
+
+    // Solvers read front to back, so let the kernel read ahead aggressively
+    madvise(data, status.st_size, MADV_SEQUENTIAL);
+    return {(const char *)data, (size_t)status.st_size};
+}
+
+/**
+ * @brief Releases an input returned by mapInputFile
+ * 
+ * @param input 
+ */
+inline void unmapInput(InputView input)
+{
+    if (input.length > 0)
+    {
+        munmap((void *)input.data, input.length);
+    }
+}
+#endif
+
+/**
+ * @brief Releases an input returned by readInput or readInputFile
+ * 
+ * @param input 
+ */
+inline void freeInput(InputView input)
+{
+    free((void *)input.data);
+}
+
+/**
+ * @brief An input file along with how it was loaded, so it can be released the same way
+ */
+typedef struct
+{
+    InputView view;
+    bool mapped;
+} InputFile;
+
+/**
+ * @brief Loads an input file for a large input, mapping it into memory where possible.
+ * Stdin, named by "-", and files on hosts without mmap are read with readInputArgument instead.
+ * 
+ * @param path 
+ * @return InputFile A view with no data if the file couldn't be loaded, release it with releaseInputFile either way
+ */
+inline InputFile acquireInputFile(const char *path)
+{
+#if INPUT_MMAP
+    if (strcmp(path, "-") != 0)
+    {
+        return {mapInputFile(path), true};
+    }
+#endif
+    return {readInputArgument(path), false};
+}
+
+/**
+ * @brief Releases an input returned by acquireInputFile
+ * 
+ * @param input 
+ */
+inline void releaseInputFile(InputFile input)
+{
+#if INPUT_MMAP
+    if (input.mapped)
+    {
+        unmapInput(input.view);
+        return;
+    }
+#endif
+    freeInput(input.view);
+}
+
+#endif /* COMMON_INPUT */
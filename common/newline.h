@@ -0,0 +1,64 @@
+#ifndef COMMON_NEWLINE
+#define COMMON_NEWLINE
+
+#include <stdint.h>
+
+/*
+    Newline masks, only available on x86-64 hosts.
+    A 64 byte block of input is compared against '\n' and the results packed into a 64 bit mask
+    with a bit per newline, so the line ends of a block are found by walking its set bits.
+    SSE2 is part of x86-64 so it is always available, AVX2 only when the processor supports it.
+*/
+
+#if defined(__x86_64__)
+#define NEWLINE_VECTOR_MASKS 1
+#include <immintrin.h>
+#else
+#define NEWLINE_VECTOR_MASKS 0
+#endif
+
+#if NEWLINE_VECTOR_MASKS
+
+/**
+ * @brief Size of the blocks newline masks are built for
+ */
+#define NEWLINE_BLOCK 64
+
+/**
+ * @brief Builds a mask of the newlines in a 64 byte block using four SSE2 compares
+ * 
+ * @param block 
+ * @return uint64_t A bit per byte, set for each newline
+ */
+inline uint64_t newlineMaskSse2(const char *block)
+{
+    const __m128i newline = _mm_set1_epi8('\n');
+    uint64_t mask = 0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i *)(block + 16 * i));
+        mask |= (uint64_t)(uint16_t)_mm_movemask_epi8(_mm_cmpeq_epi8(bytes, newline)) << (16 * i);
+    }
+    return mask;
+}
+
+/**
+ * @brief Builds a mask of the newlines in a 64 byte block using two AVX2 compares
+ * 
+ * @param block 
+ * @return uint64_t A bit per byte, set for each newline
+ */
+__attribute__((target("avx2"))) inline uint64_t newlineMaskAvx2(const char *block)
+{
+    const __m256i newline = _mm256_set1_epi8('\n');
+    __m256i low = _mm256_loadu_si256((const __m256i *)block);
+    __m256i high = _mm256_loadu_si256((const __m256i *)(block + 32));
+
+    return (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(low, newline)) |
+           (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(high, newline)) << 32;
+}
+
+#endif /* NEWLINE_VECTOR_MASKS */
+
+#endif /* COMMON_NEWLINE */
@@ -0,0 +1,24 @@
+#ifndef COMMON_THREADS
+#define COMMON_THREADS
+
+#include <stddef.h>
+#include <algorithm>
+#include <thread>
+
+/**
+ * @brief Picks how many threads to split some work between, for the host.
+ * Uses every core, as long as each thread gets at least unitsPerThread of the work.
+ *
+ * @param units Amount of work, in whatever unit the caller splits it by
+ * @param unitsPerThread Smallest amount of work worth starting a thread for
+ * @param maxThreads
+ * @return unsigned At least 1
+ */
+inline unsigned workerThreads(size_t units, size_t unitsPerThread, unsigned maxThreads)
+{
+    size_t threads = std::min<size_t>(std::thread::hardware_concurrency(), units / unitsPerThread);
+
+    return (unsigned)std::max<size_t>(1, std::min<size_t>(threads, maxThreads));
+}
+
+#endif /* COMMON_THREADS */
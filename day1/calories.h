@@ -0,0 +1,160 @@
+#ifndef DAY1_CALORIES
+#define DAY1_CALORIES
+
+#include <stdint.h>
+#include "input.h"
+#include "cpu.h"
+#include "swar.h"
+#include "simd.h"
+
+/**
+ * @brief The kernels available for parsing a calorie list
+ */
+enum CalorieKernel
+{
+    CALORIE_KERNEL_SWAR,
+    CALORIE_KERNEL_SSE2,
+    CALORIE_KERNEL_AVX2,
+    CALORIE_KERNEL_SIZE
+};
+
+/**
+ * @brief Names of each kernel, for reporting
+ */
+inline const char *CALORIE_KERNEL_NAMES[CALORIE_KERNEL_SIZE] = {"swar", "sse2", "avx2"};
+
+/**
+ * @brief Checks whether a kernel can run on this processor
+ * 
+ * @param kernel 
+ * @return true 
+ * @return false 
+ */
+inline bool calorieKernelSupported(CalorieKernel kernel)
+{
+    switch (kernel)
+    {
+    case CALORIE_KERNEL_SWAR:
+        return true;
+#if CALORIE_VECTOR_KERNELS
+    case CALORIE_KERNEL_SSE2:
+        return true;
+    case CALORIE_KERNEL_AVX2:
+        return cpuSupportsAvx2();
+#endif
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief The kernel used by parseCalorieGroups, the fastest supported one unless a benchmark picks another
+ */
+inline CalorieKernel calorieKernel = detectKernel(CALORIE_KERNEL_SIZE, calorieKernelSupported);
+
+/**
+ * @brief Parses a calorie list one line at a time, in a way the compiler can evaluate.
+ * 
+ * @tparam Total The type group totals are accumulated in
+ * @param start 
+ * @param end 
+ * @param onGroup Called with the total of each group
+ */
+template <typename Total = int, typename OnGroup>
+constexpr void parseCalorieGroupsConstant(const char *start, const char *end, OnGroup &onGroup)
+{
+    Total current = 0;
+
+    while (start < end)
+    {
+        const char *lineEnd = findChar(start, end, '\n');
+
+        if (lineEnd == NULL)
+        {
+            current += parseLineScalar<Total>(start, end);
+            break;
+        }
+
+        if (lineEnd == start)
+        {
+            // Two newlines in a row, next elf
+            onGroup(current);
+            current = 0;
+        }
+        else
+        {
+            current += parseLineScalar<Total>(start, lineEnd);
+        }
+        start = lineEnd + 1;
+    }
+
+    onGroup(current);
+}
+
+/**
+ * @brief Parses a calorie list, calling onGroup with the total of each elf.
+ * Uses the selected kernel, groups may be reported in any order.
+ * When evaluated by the compiler the list is parsed with parseCalorieGroupsConstant instead.
+ * Totals are accumulated in an int by default, inputs that could overflow it should be parsed with a 64 bit Total.
+ * 
+ * @tparam Total The type group totals are accumulated in
+ * @param start 
+ * @param end 
+ * @param onGroup Called with the total of each group
+ */
+template <typename Total = int, typename OnGroup>
+constexpr void parseCalorieGroups(const char *start, const char *end, OnGroup &&onGroup)
+{
+    if (isConstantEvaluated())
+    {
+        parseCalorieGroupsConstant<Total>(start, end, onGroup);
+        return;
+    }
+
+    switch (calorieKernel)
+    {
+#if CALORIE_VECTOR_KERNELS
+    case CALORIE_KERNEL_AVX2:
+        parseCalorieGroupsAvx2<Total>(start, end, onGroup);
+        break;
+    case CALORIE_KERNEL_SSE2:
+        parseCalorieGroupsSse2<Total>(start, end, onGroup);
+        break;
+#endif
+    default:
+        parseCalorieGroupsSwar<Total>(start, end, onGroup);
+        break;
+    }
+}
+
+/**
+ * @brief Parses a calorie list, calling onGroup with the total of each elf in input order.
+ * The vector kernels already report groups in order, the SWAR kernel is swapped for a single cursor,
+ * which gives up overlapping its lines for the order.
+ * 
+ * @tparam Total The type group totals are accumulated in
+ * @param start 
+ * @param end 
+ * @param onGroup Called with the total of each group
+ */
+template <typename Total = int, typename OnGroup>
+inline void parseCalorieGroupsInOrder(const char *start, const char *end, OnGroup &&onGroup)
+{
+    if (calorieKernel != CALORIE_KERNEL_SWAR)
+    {
+        parseCalorieGroups<Total>(start, end, onGroup);
+        return;
+    }
+
+    CalorieCursor<Total> cursor = {start, end, 0};
+
+    while (cursor.position < end)
+    {
+        nextLine(&cursor, loadWord(cursor.position, end), onGroup);
+    }
+
+    // Last elf, as the input doesn't end with a blank line
+    onGroup(cursor.current);
+}
+
+#endif /* DAY1_CALORIES */
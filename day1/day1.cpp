@@ -3,18 +3,22 @@
 #include <stdint.h> 
 #include "pico/stdlib.h"
 #include "day1.h"
+#include "input.h"
+#include "answer.h"
+#include "calories.h"
+#include "topk.h"
+#include "stream.h"
+#include "dualcore.h"
+#include "ranking.h"
+#include "leaderboard.h"
+#if !PICO_ON_DEVICE
+#include "parallel.h"
+#endif
 #include <algorithm>
 #include <cstring>
 
 using namespace std;
 
-enum ParserState {
-    NEXT,
-    END_OF_LINE,
-    READING,
-    IDLE
-};
-
 
 /**
  * @brief Part 1 of Day 1
@@ -24,212 +28,350 @@ enum ParserState {
  * 
  * Our goal for part 1 is to calculate which elf has the highest amount of calories in their storage.
  * 
- * To do this I loop through the input reading the input 1 character at a time.
- * I manage a state that will change depending on the values being read in, where a newline
- * will represent a new food item, and two new lines a new elf.
- * To calculate the values I read the input from back to front calculating the numeric representation of the character
- * and adding it to the total. By reading back to front I can increment a power of 10 to correctly position each digit without needing
- * to read the whole input at once.
+ * To do this I parse the input front to back, 8 bytes at a time. Each block of the input is turned into a
+ * mask of its newlines, where a newline will represent a new food item, and two new lines a new elf.
+ * Each line is then converted into its numeric value in a single step by lining its digits up in a 64 bit
+ * word and combining them with a few multiplications, rather than adding one power of 10 per character.
+ * The parser hands back the total of each elf, and I keep the largest.
  * 
+ * @param input 
  * @return int 
  */
-int partOne(const char input[])
+constexpr int partOne(InputView input)
 {
-    int radix = 1;
-    int state = IDLE;
     int localMax = 0;
-    int current = 0;
 
-    size_t inputLength = strlen(input) - 1;
+    parseCalorieGroups(input.data, input.data + input.length, [&](int current) {
+        localMax = max(localMax, current);
+    });
 
-    /*
-    Loop through entire Input from back to front.
-    We do this so we can progressively add powers of 10 
-    without the need to read the entire line first
-    */
-    for (int i = inputLength; i >= 0; i--)
-    {
-        // Read the next character
-        char value = input[i];
-
-        /* 
-        Update the state based off the read character
-        This will dictate what action we take on this loop
-        */
-        switch (value)
-        {
-        // A single newline will dictate an end line and to read the next value for the elf
-        // Two newlines will dictate a new elf
-        case '\n': 
-            state = state == END_OF_LINE ? NEXT : END_OF_LINE;
-            break;
-        default:
-            state = READING;
-            break;
-        }
+    return localMax;
+}
 
-        /*
-        The task to execute based off our state
-        */
-        switch (state)
-        {
-        case NEXT: // Next Elf, so we will update our max
-            localMax = max(localMax, current);
-            current = 0;
-            break;
-        case READING: // Read the next value into our current total
-            current += (value - 48) * radix;
-            radix *= 10;
-            break;
-        case END_OF_LINE: // We reset our radix on a newline
-            radix = 1;
-            break;
-        default:
-            break;
-        }
-    }
+/**
+ * @brief Number of elves whose calories are summed in part 2
+ */
+#define TOP_SIZE 3
+
+/**
+ * @brief Part 2 of Day 1
+ * The problem consists of an input which contains a list of numeric values seperates by newlines
+ * Each group of values represents a single elfs storage of food items, with the values being
+ * the calories of each item.
+ * 
+ * Our goal for part 2 is to calculate the top 3 elves that have the highest amount of calories in their storage.
+ * 
+ * Similar to part 1 I parse the input front to back using the same parser.
+ * The difference is how I calculate the maximum, where I now feed every total to a top K selector
+ * which keeps the 3 largest values. For a K this small it keeps them sorted and only does any work
+ * for the rare total that beats the smallest of the three.
+ * 
+ * @param input 
+ * @return int 
+ */
+constexpr int partTwo(InputView input)
+{
+    TopK<TOP_SIZE> localMax = {};
 
-    // Last calculation as we won't have a newline at the start if our input;
-    return max(localMax, current);
+    parseCalorieGroups(input.data, input.data + input.length, [&](int current) {
+        pushTopK(localMax, current);
+    });
+
+    return sumTopK(localMax);
 }
 
-#define TOP_SIZE 3
+#ifndef AOC_NO_MAIN
+/**
+ * @brief Build with the input streamed from stdin rather than embedded, see streamCalories
+ */
+#ifndef DAY1_STREAM_INPUT
+#define DAY1_STREAM_INPUT 0
+#endif
 
 /**
- * @brief Updates the maximum values stored in an array.
- * Maintains a ordered array of maxium values to reduce the number of comparisons required.
- * As we can compare from lowest to highest quickly rejecting any values that won't fit in our max values.
- * If our new value is larger than any of our maximums, we will then loop backwards from the position it fits
- * swapping each value as we reach the end of our array.
+ * @brief Build with the actual input solved on both cores, see solveDualCore
+ */
+#ifndef DAY1_DUAL_CORE
+#define DAY1_DUAL_CORE 0
+#endif
+
+/**
+ * @brief Size of the chunks a streamed input is read in
+ */
+#define STREAM_CHUNK_SIZE 4096
+
+/**
+ * @brief Reads the next chunk of a streamed input from stdin.
+ * Over USB the board never sees the end of stdin, so there the input is ended with Ctrl+D (end of transmission).
+ * Carriage returns sent by terminals are dropped on the board.
  * 
- * @param value
- * @param maximums
+ * @param chunk 
+ * @param size 
+ * @return size_t The number of bytes read, less than size once the input has ended
  */
-inline void checkMax(int value, int maximums[])
+size_t readStreamChunk(char chunk[], size_t size)
 {
-    int max = TOP_SIZE - 1;
-    int i = max;
+#if PICO_ON_DEVICE
+    size_t length = 0;
 
-    while (i >= 0)
+    while (length < size)
     {
-        if (maximums[i] > value)
+        int value = getchar();
+
+        if (value == EOF || value == 0x04)
         {
             break;
         }
-        i--;
+        if (value != '\r')
+        {
+            chunk[length++] = value;
+        }
     }
+    return length;
+#else
+    return fread(chunk, 1, size, stdin);
+#endif
+}
 
-    i++;
+/**
+ * @brief Solves both parts for an input streamed from stdin in fixed size chunks.
+ * Only a single chunk is held in memory at a time, so the input can be any size.
+ */
+void streamCalories()
+{
+    static char chunk[STREAM_CHUNK_SIZE];
+    CalorieStream<TOP_SIZE> stream = {};
+    size_t length;
 
-    while (i <= max)
+    do
     {
-        value ^= maximums[i];
-        maximums[i] ^= value;
-        value ^= maximums[i++];
-    }
+        length = readStreamChunk(chunk, STREAM_CHUNK_SIZE);
+        feedCalories(stream, chunk, length);
+    } while (length == STREAM_CHUNK_SIZE);
 
+    finishCalories(stream);
 
+    printf("---- Day 1 part 1 Stream ----\n");
+    printf("Result: %d\n", maxTopK(stream.top));
+    printf("---- Day 1 part 2 Stream ----\n");
+    printf("Result: %d\n", sumTopK(stream.top));
 }
 
+#if !PICO_ON_DEVICE
 /**
- * @brief Part 2 of Day 1
- * The problem consists of an input which contains a list of numeric values seperates by newlines
- * Each group of values represents a single elfs storage of food items, with the values being
- * the calories of each item.
+ * @brief Solves both parts for an input file in a single pass split across every core.
+ * Meant for inputs far larger than the puzzle's, so the file is memory mapped where possible
+ * and totals are accumulated in 64 bits.
  * 
- * Our goal for part 2 is to calculate the top 3 elves that have the highest amount of calories in their storage.
- * 
- * Similar to part 1 I loop through the input from back to front reading the input 1 character at a time.
- * The difference is how I calculate the maximum, where I now maintain an ordered array of maximum values and
- * so that we can store the top 3 values.
- * 
- * @return int 
+ * @param path The input file, or "-" for stdin
+ * @return int 0 on success
  */
-int partTwo(const char input[])
+int solveParallel(const char *path)
 {
-    int radix = 1;
-    int state = IDLE;
-    int localMax[TOP_SIZE];
+    InputFile input = acquireInputFile(path);
 
-    memset(localMax, 0, TOP_SIZE * sizeof(int));    
+    if (input.view.data == NULL)
+    {
+        printf("Unable to read %s\n", path);
+        return 1;
+    }
+
+    TopK<TOP_SIZE, int64_t> top = reduceCaloriesParallel<TOP_SIZE, int64_t>(input.view);
 
-    int current = 0;
+    printf("---- Day 1 part 1 Parallel ----\n");
+    printf("Result: %lld\n", (long long)maxTopK(top));
+    printf("---- Day 1 part 2 Parallel ----\n");
+    printf("Result: %lld\n", (long long)sumTopK(top));
 
-    size_t inputLength = strlen(input) - 1;
+    releaseInputFile(input);
+    return 0;
+}
+#endif
 
-    /*
-    Loop through entire Input from back to front.
-    We do this so we can progressively add powers of 10 
-    without the need to read the entire line first
-    */
-    for (int i = inputLength; i >= 0; i--)
+/**
+ * @brief Solves both parts on both cores, and times it against solving part 2 on a single core
+ * 
+ * @param input 
+ */
+void solveDualCore(InputView input)
+{
+    uint64_t start = time_us_64();
+    int single = partTwo(input);
+    uint64_t singleUs = time_us_64() - start;
+
+    start = time_us_64();
+    TopK<TOP_SIZE> top = reduceCaloriesDualCore<TOP_SIZE>(input);
+    uint64_t dualUs = time_us_64() - start;
+
+    printf("---- Day 1 part 1 Dual Core ----\n");
+    printf("Result: %d\n", maxTopK(top));
+    printf("---- Day 1 part 2 Dual Core ----\n");
+    printf("Result: %d\n", sumTopK(top));
+    printf("Single core %llu us (%s), dual core %llu us\n", (unsigned long long)singleUs,
+           single == sumTopK(top) ? "matches" : "differs", (unsigned long long)dualUs);
+}
+
+/**
+ * @brief Follows a calorie list as it is appended to stdin, keeping an online leaderboard.
+ * The answers are reported as each elf ends, and once more with the last elf when the input ends,
+ * which over USB is marked with Ctrl+D (end of transmission).
+ */
+void followCalories()
+{
+    CalorieLeaderboard<TOP_SIZE> board = {};
+    uint32_t line = 0;
+    bool inLine = false;
+    int value;
+
+    while ((value = getchar()) != EOF && value != 0x04)
     {
-        // Read the next character
-        char value = input[i];
-
-        /* 
-        Update the state based off the read character
-        This will dictate what action we take on this loop
-        */
-        switch (value)
+        if (value == '\r')
         {
-        // A single newline will dictate an end line and to read the next value for the elf
-        // Two newlines will dictate a new elf
-        case '\n': 
-            state = state == END_OF_LINE ? NEXT : END_OF_LINE;
-            break;
-        default:
-            state = READING;
-            break;
+            continue;
         }
 
-        /*
-        The task to execute based off our state
-        */
-        switch (state)
+        if (value != '\n')
         {
-        case NEXT: // Next Elf, so we will update our max
-            checkMax(current, localMax);
-            current = 0;
-            break;
-        case READING: // Read the next value into our current total
-            current += (value - 48) * radix;
-            radix *= 10;
-            break;
-        case END_OF_LINE: // We reset our radix on a newline
-            radix = 1;
-            break;
-        default:
-            break;
+            line = line * 10 + (value - 48);
+            inLine = true;
+        }
+        else if (inLine)
+        {
+            addLeaderboardItem(board, (int)line);
+            line = 0;
+            inLine = false;
+        }
+        else
+        {
+            endLeaderboardGroup(board);
+            printf("Elves: %zu, part 1: %d, part 2: %d\n", board.groups, leaderboardMax(board), leaderboardTopSum(board));
         }
     }
 
-    // Last calculation as we won't have a newline at the start if our input;
-    checkMax(current, localMax);
+    if (inLine)
+    {
+        addLeaderboardItem(board, (int)line);
+    }
+    endLeaderboardGroup(board);
 
-    int result = 0;
+    printf("---- Day 1 part 1 Follow ----\n");
+    printf("Result: %d\n", leaderboardMax(board));
+    printf("---- Day 1 part 2 Follow ----\n");
+    printf("Result: %d\n", leaderboardTopSum(board));
+}
 
-    for (size_t i = 0; i < TOP_SIZE; i++)
-    {
-        result += localMax[i];
-    }   
+/**
+ * @brief Ranks every elf of an input, and reports the spread of their calories
+ * 
+ * @param input 
+ * @return int 0 on success
+ */
+int solveRanking(InputView input)
+{
+    CalorieRanking ranking = buildCalorieRanking(input);
 
+    if (ranking.count == 0)
+    {
+        printf("Out of memory ranking %zu bytes\n", input.length);
+        return 1;
+    }
 
-    return result;
+    printf("---- Day 1 Ranking ----\n");
+    printf("Elves: %zu\n", ranking.count);
+    printf("Top 3: %u %u %u\n", totalAtRank(&ranking, 1),
+           totalAtRank(&ranking, std::min<size_t>(2, ranking.count)),
+           totalAtRank(&ranking, std::min<size_t>(3, ranking.count)));
+    printf("Percentiles: p50 %u, p90 %u, p99 %u\n", totalAtPercentile(&ranking, 50),
+           totalAtPercentile(&ranking, 90), totalAtPercentile(&ranking, 99));
+    printf("First elf: rank %u\n", rankOfGroup(&ranking, 0));
+
+    freeCalorieRanking(&ranking);
+    return 0;
 }
 
-int main()
+/**
+ * @brief Solves the embedded inputs, or the input file named by the first argument instead of the actual input.
+ * Passing "-" reads the input from stdin, and "--stream" streams it from stdin instead of reading it whole.
+ * "--follow" keeps a leaderboard as the input is appended to stdin,
+ * "--dual-core [file]" solves the input on both cores, "--ranking [file]" ranks every elf,
+ * and on the host "--parallel <file>" solves it on every core.
+ * Answers for the embedded inputs may be folded at compile time.
+ */
+int main(int argc, char *argv[])
 {
+    constexpr InputView test = inputView(TEST_INPUT);
+    constexpr InputView embedded = inputView(ACTUAL_INPUT);
+    bool stream = DAY1_STREAM_INPUT || (argc > 1 && strcmp(argv[1], "--stream") == 0);
+    bool follow = argc > 1 && strcmp(argv[1], "--follow") == 0;
+    bool parallel = !PICO_ON_DEVICE && argc > 2 && strcmp(argv[1], "--parallel") == 0;
+    bool dualCore = DAY1_DUAL_CORE || (argc > 1 && strcmp(argv[1], "--dual-core") == 0);
+    bool ranking = argc > 1 && strcmp(argv[1], "--ranking") == 0;
+    // The input file follows the mode when one is given
+    int inputArgument = (dualCore && argc > 1) || ranking ? 2 : 1;
+    bool owned = argc > inputArgument && !stream && !parallel && !follow;
+    InputView actual = owned ? readInputArgument(argv[inputArgument]) : embedded;
+
     stdio_init_all();
 
+#if !PICO_ON_DEVICE
+    if (parallel)
+    {
+        return solveParallel(argv[2]);
+    }
+#endif
+
+    if (actual.data == NULL)
+    {
+        printf("Unable to read %s\n", argv[inputArgument]);
+        return 1;
+    }
+
     sleep_ms(1000);
 
+    if (stream)
+    {
+        streamCalories();
+        return 0;
+    }
+
+    if (follow)
+    {
+        followCalories();
+        return 0;
+    }
+
+    if (ranking)
+    {
+        int result = solveRanking(actual);
+        if (owned)
+        {
+            freeInput(actual);
+        }
+        return result;
+    }
+
+    if (dualCore)
+    {
+        solveDualCore(actual);
+        if (owned)
+        {
+            freeInput(actual);
+        }
+        return 0;
+    }
+
     printf("---- Day 1 part 1 Test ----\n");
-    printf("Result: %d\n", partOne(TEST_INPUT));
+    printf("Result: %d\n", AOC_ANSWER(partOne, test));
     printf("---- Day 1 part 1 ----\n");
-    printf("Result: %d\n", partOne(ACTUAL_INPUT));
+    printf("Result: %d\n", owned ? partOne(actual) : AOC_ANSWER(partOne, embedded));
     printf("---- Day 1 part 2 Test ----\n");
-    printf("Result: %d\n", partTwo(TEST_INPUT));
+    printf("Result: %d\n", AOC_ANSWER(partTwo, test));
     printf("---- Day 1 part 2 ----\n");
-    printf("Result: %d\n", partTwo(ACTUAL_INPUT));
-}
\ No newline at end of file
+    printf("Result: %d\n", owned ? partTwo(actual) : AOC_ANSWER(partTwo, embedded));
+
+    if (owned)
+    {
+        freeInput(actual);
+    }
+}
+#endif /* AOC_NO_MAIN */
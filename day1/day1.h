@@ -1,7 +1,7 @@
 #ifndef DAY1
 #define DAY1
 
-const char* TEST_INPUT = "1000\n\
+constexpr char TEST_INPUT[] = "1000\n\
 2000\n\
 3000\n\
 \n\
@@ -16,7 +16,7 @@ const char* TEST_INPUT = "1000\n\
 \n\
 10000";
 
-const char* ACTUAL_INPUT = "9548\n\
+constexpr char ACTUAL_INPUT[] = "9548\n\
 3738\n\
 \n\
 18492\n\
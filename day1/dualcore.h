@@ -0,0 +1,79 @@
+#ifndef DAY1_DUALCORE
+#define DAY1_DUALCORE
+
+#include <stddef.h>
+#include <stdint.h>
+#include "pico/multicore.h"
+#include "input.h"
+#include "calories.h"
+#include "topk.h"
+
+/*
+    Dual core calorie reduction.
+    The input is split in half at a blank line, core 0 reduces the first half while core 1 reduces the
+    second, and core 1 hands its top K back over the inter-core FIFO one value at a time.
+    Only the Pico SDK multicore API is used, which the host build provides with a thread standing in for
+    core 1, so the split and merge can be checked on the host before timing them on the board.
+*/
+
+/**
+ * @brief The half of the input given to core 1, set before core 1 is launched
+ */
+inline CalorieCursor<> core1Split;
+
+/**
+ * @brief Entry point of core 1, reduces core1Split and pushes its K largest elves to core 0
+ *
+ * @tparam K
+ */
+template <size_t K>
+void reduceCaloriesCore1()
+{
+    CalorieCursor<> split = core1Split;
+    TopK<K> top = {};
+
+    // The second half is empty when the input has no blank line past its middle
+    if (split.position < split.end)
+    {
+        parseCalorieGroups(split.position, split.end, [&](int current) {
+            pushTopK(top, current);
+        });
+    }
+
+    for (size_t i = 0; i < K; i++)
+    {
+        multicore_fifo_push_blocking((uint32_t)top.values[i]);
+    }
+}
+
+/**
+ * @brief Selects the K largest elves of a calorie list, splitting the work between both cores
+ *
+ * @tparam K
+ * @param input
+ * @return TopK<K>
+ */
+template <size_t K>
+inline TopK<K> reduceCaloriesDualCore(InputView input)
+{
+    CalorieCursor<> splits[2];
+    TopK<K> top = {};
+
+    splitCalorieGroups(input.data, input.data + input.length, splits, 2);
+
+    core1Split = splits[1];
+    multicore_reset_core1();
+    multicore_launch_core1(reduceCaloriesCore1<K>);
+
+    parseCalorieGroups(splits[0].position, splits[0].end, [&](int current) {
+        pushTopK(top, current);
+    });
+
+    for (size_t i = 0; i < K; i++)
+    {
+        pushTopK(top, (int)multicore_fifo_pop_blocking());
+    }
+    return top;
+}
+
+#endif /* DAY1_DUALCORE */
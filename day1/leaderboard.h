@@ -0,0 +1,99 @@
+#ifndef DAY1_LEADERBOARD
+#define DAY1_LEADERBOARD
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include "topk.h"
+
+/*
+    Online calorie leaderboard.
+    Items and the ends of groups are appended one at a time, as they arrive, and the leaderboard is
+    always ready to answer. Alongside the top K it keeps the sum of the top K and the largest total,
+    both updated as groups end, so answering never needs to look at the K totals.
+    The group still being appended counts as an elf too, it is folded into the answers on the fly
+    by checking whether it would displace the smallest of the top K.
+*/
+
+/**
+ * @brief State of an online leaderboard, starts out zeroed
+ *
+ * @tparam K Number of the largest groups kept
+ * @tparam Total The type group totals are accumulated in
+ */
+template <size_t K, typename Total = int>
+struct CalorieLeaderboard
+{
+    // Total of the group being appended
+    Total current;
+    // Largest ended groups
+    TopK<K, Total> top;
+    // Sum of top
+    Total topSum;
+    // Largest ended group
+    Total best;
+    // Number of ended groups
+    size_t groups;
+};
+
+/**
+ * @brief Appends an item to the current group, in O(1)
+ *
+ * @param board
+ * @param calories
+ */
+template <size_t K, typename Total>
+constexpr void addLeaderboardItem(CalorieLeaderboard<K, Total> &board, Total calories)
+{
+    board.current += calories;
+}
+
+/**
+ * @brief Ends the current group, in O(K) for small K and O(log K) otherwise
+ *
+ * @param board
+ */
+template <size_t K, typename Total>
+constexpr void endLeaderboardGroup(CalorieLeaderboard<K, Total> &board)
+{
+    Total current = board.current;
+
+    if (current > board.top.values[0])
+    {
+        // values[0] is the smallest kept, and the one the new total displaces
+        board.topSum += current - board.top.values[0];
+        pushTopK(board.top, current);
+    }
+
+    board.best = std::max(board.best, current);
+    board.current = 0;
+    board.groups++;
+}
+
+/**
+ * @brief Largest group total so far, including the group being appended, in O(1)
+ *
+ * @param board
+ * @return Total
+ */
+template <size_t K, typename Total>
+constexpr Total leaderboardMax(const CalorieLeaderboard<K, Total> &board)
+{
+    return std::max(board.best, board.current);
+}
+
+/**
+ * @brief Sum of the K largest group totals so far, including the group being appended, in O(1)
+ *
+ * @param board
+ * @return Total
+ */
+template <size_t K, typename Total>
+constexpr Total leaderboardTopSum(const CalorieLeaderboard<K, Total> &board)
+{
+    Total smallest = board.top.values[0];
+
+    return board.current > smallest ? board.topSum - smallest + board.current : board.topSum;
+}
+
+#endif /* DAY1_LEADERBOARD */
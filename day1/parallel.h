@@ -0,0 +1,82 @@
+#ifndef DAY1_PARALLEL
+#define DAY1_PARALLEL
+
+#include <stddef.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "input.h"
+#include "threads.h"
+#include "calories.h"
+#include "topk.h"
+
+/*
+    Multi-threaded calorie reduction, for the host.
+    The input is split at blank lines into one chunk per thread, the same way the SWAR parser splits
+    it between its cursors. An elf that straddles a split point is kept whole by moving the split
+    forward to the next blank line, so every elf belongs to exactly one chunk.
+    Each thread selects the top K of its own chunk and the partial leaderboards are merged at the end,
+    threads only share the input and write a single result each.
+*/
+
+/**
+ * @brief Smallest chunk worth starting a thread for
+ */
+#define CALORIE_THREAD_BYTES (1 << 20)
+
+/**
+ * @brief Most threads a reduction is split between
+ */
+#define CALORIE_MAX_THREADS 64
+
+/**
+ * @brief Selects the K largest elves of a calorie list using several threads
+ *
+ * @tparam K
+ * @tparam Total The type group totals are accumulated in, a 64 bit total for inputs that may overflow an int
+ * @param input
+ * @param threads Number of threads, including the calling thread. 0 uses every core, with at least CALORIE_THREAD_BYTES each
+ * @return TopK<K, Total>
+ */
+template <size_t K, typename Total = int>
+inline TopK<K, Total> reduceCaloriesParallel(InputView input, unsigned threads = 0)
+{
+    threads = threads == 0 ? workerThreads(input.length, CALORIE_THREAD_BYTES, CALORIE_MAX_THREADS)
+                           : std::min<unsigned>(threads, CALORIE_MAX_THREADS);
+
+    CalorieCursor<Total> splits[CALORIE_MAX_THREADS];
+    std::vector<TopK<K, Total>> partials(threads, TopK<K, Total>{});
+    std::vector<std::thread> workers;
+
+    splitCalorieGroups(input.data, input.data + input.length, splits, threads);
+
+    auto reduce = [&](unsigned i) {
+        TopK<K, Total> top = {};
+
+        // Chunks past the last blank line are empty, rather than holding an elf with no items
+        if (i == 0 || splits[i].position < splits[i].end)
+        {
+            parseCalorieGroups<Total>(splits[i].position, splits[i].end, [&](Total current) {
+                pushTopK(top, current);
+            });
+        }
+        partials[i] = top;
+    };
+
+    for (unsigned i = 1; i < threads; i++)
+    {
+        workers.emplace_back(reduce, i);
+    }
+    reduce(0);
+
+    TopK<K, Total> result = partials[0];
+
+    for (unsigned i = 1; i < threads; i++)
+    {
+        workers[i - 1].join();
+        mergeTopK(result, partials[i]);
+    }
+    return result;
+}
+
+#endif /* DAY1_PARALLEL */
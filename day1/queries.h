@@ -0,0 +1,148 @@
+#ifndef DAY1_QUERIES
+#define DAY1_QUERIES
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include "input.h"
+#include "calories.h"
+#include "topk.h"
+
+/*
+    Fused calorie queries.
+    Every query over a calorie list only needs the total of each elf, so rather than parsing the input
+    once per answer the queries are registered together and fed from a single pass of the parser.
+    Each query is a plain struct with an addGroup overload, the set of queries is fixed at compile time
+    so the calls are inlined straight into the parser's group callback.
+    Like the parser, queries hold totals as Total, an int unless the input may overflow one.
+*/
+
+/**
+ * @brief Largest group total
+ *
+ * @tparam Total
+ */
+template <typename Total = int>
+struct MaxQuery
+{
+    Total value;
+};
+
+/**
+ * @brief Sum of every group total
+ */
+typedef struct
+{
+    int64_t value;
+} SumQuery;
+
+/**
+ * @brief Number of groups
+ */
+typedef struct
+{
+    size_t value;
+} CountQuery;
+
+/**
+ * @brief Mean of the group totals, read with meanOf
+ */
+typedef struct
+{
+    int64_t sum;
+    size_t count;
+} MeanQuery;
+
+/**
+ * @brief Histogram of the group totals in buckets of a fixed width.
+ * Bucket i counts totals in [i * width, (i + 1) * width), the last bucket also counts everything above it.
+ *
+ * @tparam Buckets
+ * @tparam Total
+ */
+template <size_t Buckets, typename Total = int>
+struct HistogramQuery
+{
+    static_assert(Buckets > 0, "A histogram needs at least one bucket");
+
+    Total width;
+    size_t counts[Buckets];
+};
+
+/**
+ * @brief Adds a group total to a query, there is one overload per kind of query
+ *
+ * @tparam Total
+ * @param query
+ * @param total
+ */
+template <typename Total>
+constexpr void addGroup(MaxQuery<Total> &query, Total total)
+{
+    query.value = std::max(query.value, total);
+}
+
+template <typename Total>
+constexpr void addGroup(SumQuery &query, Total total)
+{
+    query.value += total;
+}
+
+template <typename Total>
+constexpr void addGroup(CountQuery &query, Total)
+{
+    query.value++;
+}
+
+template <typename Total>
+constexpr void addGroup(MeanQuery &query, Total total)
+{
+    query.sum += total;
+    query.count++;
+}
+
+template <size_t Buckets, typename Total>
+constexpr void addGroup(HistogramQuery<Buckets, Total> &query, Total total)
+{
+    size_t bucket = (size_t)(total / query.width);
+
+    query.counts[std::min(bucket, Buckets - 1)]++;
+}
+
+/**
+ * @brief The K largest group totals, see TopK
+ */
+template <size_t K, typename Total>
+constexpr void addGroup(TopK<K, Total> &query, Total total)
+{
+    pushTopK(query, total);
+}
+
+/**
+ * @brief Reads the mean from a mean query
+ *
+ * @param query
+ * @return double 0 when there were no groups
+ */
+constexpr double meanOf(const MeanQuery &query)
+{
+    return query.count == 0 ? 0.0 : (double)query.sum / query.count;
+}
+
+/**
+ * @brief Answers every query with a single pass over a calorie list.
+ * Queries keep their state between calls, so they should be initialized before the first run.
+ *
+ * @tparam Total The type group totals are accumulated in, every query has to hold the same type
+ * @param input
+ * @param queries Any number of queries, each with an addGroup overload
+ */
+template <typename Total = int, typename... Queries>
+constexpr void runCalorieQueries(InputView input, Queries &...queries)
+{
+    parseCalorieGroups<Total>(input.data, input.data + input.length, [&](Total current) {
+        (addGroup(queries, current), ...);
+    });
+}
+
+#endif /* DAY1_QUERIES */
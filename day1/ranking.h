@@ -0,0 +1,239 @@
+#ifndef DAY1_RANKING
+#define DAY1_RANKING
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include "input.h"
+#include "calories.h"
+
+/*
+    Ranking of every elf.
+    The totals of every group are collected in input order and sorted once with a radix sort, after
+    which the rank of any group, the total at any rank or percentile, and the rank a total would have
+    are all answered from the sorted array without touching the input again.
+    Totals are sorted as unsigned 32 bit keys, 8 bits per pass, which takes 4 linear passes no matter how
+    many groups there are. The histograms of every pass are built together in a single read, and passes
+    where every key has the same digit, like the top byte of any realistic total, are skipped.
+*/
+
+/**
+ * @brief Bits sorted per radix pass
+ */
+#define RANKING_RADIX_BITS 8
+#define RANKING_RADIX_SIZE (1 << RANKING_RADIX_BITS)
+#define RANKING_RADIX_PASSES (32 / RANKING_RADIX_BITS)
+
+/**
+ * @brief Every group total of a calorie list, ranked
+ */
+typedef struct
+{
+    // Group totals, smallest first
+    uint32_t *sorted;
+    // Rank of each group in input order, 1 being the most calories. Equal totals share a rank
+    uint32_t *ranks;
+    size_t count;
+} CalorieRanking;
+
+/**
+ * @brief Sorts keys smallest first with an LSD radix sort, moving each key's index along with it.
+ * The sort is stable, so equal keys keep their input order.
+ *
+ * @param keys
+ * @param indices
+ * @param count
+ * @param keyScratch Room for count keys
+ * @param indexScratch Room for count indices
+ */
+inline void radixSortTotals(uint32_t *keys, uint32_t *indices, size_t count, uint32_t *keyScratch, uint32_t *indexScratch)
+{
+    if (count == 0)
+    {
+        return;
+    }
+
+    size_t counts[RANKING_RADIX_PASSES][RANKING_RADIX_SIZE] = {};
+    uint32_t *fromKeys = keys, *fromIndices = indices, *toKeys = keyScratch, *toIndices = indexScratch;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        for (int pass = 0; pass < RANKING_RADIX_PASSES; pass++)
+        {
+            counts[pass][(keys[i] >> (pass * RANKING_RADIX_BITS)) & (RANKING_RADIX_SIZE - 1)]++;
+        }
+    }
+
+    for (int pass = 0; pass < RANKING_RADIX_PASSES; pass++)
+    {
+        int shift = pass * RANKING_RADIX_BITS;
+        size_t *digits = counts[pass];
+
+        // Every key shares this digit, the pass wouldn't move anything
+        if (digits[(keys[0] >> shift) & (RANKING_RADIX_SIZE - 1)] == count)
+        {
+            continue;
+        }
+
+        // Turn the counts into the position each digit starts at
+        size_t position = 0;
+        for (int digit = 0; digit < RANKING_RADIX_SIZE; digit++)
+        {
+            size_t digitCount = digits[digit];
+            digits[digit] = position;
+            position += digitCount;
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            size_t target = digits[(fromKeys[i] >> shift) & (RANKING_RADIX_SIZE - 1)]++;
+            toKeys[target] = fromKeys[i];
+            toIndices[target] = fromIndices[i];
+        }
+
+        std::swap(fromKeys, toKeys);
+        std::swap(fromIndices, toIndices);
+    }
+
+    if (fromKeys != keys)
+    {
+        memcpy(keys, fromKeys, count * sizeof(uint32_t));
+        memcpy(indices, fromIndices, count * sizeof(uint32_t));
+    }
+}
+
+/**
+ * @brief Ranks every group of a calorie list
+ *
+ * @param input
+ * @return CalorieRanking A ranking with no groups if memory ran out, release it with freeCalorieRanking
+ */
+inline CalorieRanking buildCalorieRanking(InputView input)
+{
+    size_t capacity = 1024, count = 0;
+    uint32_t *totals = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+    bool failed = totals == NULL;
+
+    parseCalorieGroupsInOrder(input.data, input.data + input.length, [&](int current) {
+        if (count == capacity && !failed)
+        {
+            uint32_t *grown = (uint32_t *)realloc(totals, 2 * capacity * sizeof(uint32_t));
+            failed = grown == NULL;
+            totals = failed ? totals : grown;
+            capacity *= failed ? 1 : 2;
+        }
+        if (!failed)
+        {
+            totals[count++] = (uint32_t)current;
+        }
+    });
+
+    uint32_t *indices = (uint32_t *)malloc(count * sizeof(uint32_t));
+    uint32_t *keyScratch = (uint32_t *)malloc(count * sizeof(uint32_t));
+    uint32_t *indexScratch = (uint32_t *)malloc(count * sizeof(uint32_t));
+
+    if (failed || indices == NULL || keyScratch == NULL || indexScratch == NULL)
+    {
+        free(totals);
+        free(indices);
+        free(keyScratch);
+        free(indexScratch);
+        return {NULL, NULL, 0};
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        indices[i] = (uint32_t)i;
+    }
+
+    radixSortTotals(totals, indices, count, keyScratch, indexScratch);
+
+    // Reuse the key scratch for the ranks, walking down from the largest total
+    uint32_t *ranks = keyScratch;
+    uint32_t rank = 1;
+
+    for (size_t i = count; i-- > 0;)
+    {
+        if (i + 1 < count && totals[i] != totals[i + 1])
+        {
+            rank = (uint32_t)(count - i);
+        }
+        ranks[indices[i]] = rank;
+    }
+
+    free(indices);
+    free(indexScratch);
+
+    return {totals, ranks, count};
+}
+
+/**
+ * @brief Releases a ranking returned by buildCalorieRanking
+ *
+ * @param ranking
+ */
+inline void freeCalorieRanking(CalorieRanking *ranking)
+{
+    free(ranking->sorted);
+    free(ranking->ranks);
+    *ranking = {NULL, NULL, 0};
+}
+
+/**
+ * @brief Rank of a group, in O(1)
+ *
+ * @param ranking
+ * @param group Index of the group in input order
+ * @return uint32_t 1 for the group with the most calories
+ */
+inline uint32_t rankOfGroup(const CalorieRanking *ranking, size_t group)
+{
+    return ranking->ranks[group];
+}
+
+/**
+ * @brief Total of the group at a rank, in O(1)
+ *
+ * @param ranking
+ * @param rank From 1 for the most calories, up to the number of groups
+ * @return uint32_t
+ */
+inline uint32_t totalAtRank(const CalorieRanking *ranking, size_t rank)
+{
+    return ranking->sorted[ranking->count - rank];
+}
+
+/**
+ * @brief Rank a group with this total would have, in O(log n)
+ *
+ * @param ranking
+ * @param total
+ * @return uint32_t 1 plus the number of groups with more calories
+ */
+inline uint32_t rankOfTotal(const CalorieRanking *ranking, uint32_t total)
+{
+    const uint32_t *end = ranking->sorted + ranking->count;
+
+    return (uint32_t)(end - std::upper_bound((const uint32_t *)ranking->sorted, end, total)) + 1;
+}
+
+/**
+ * @brief Total at a percentile, using the nearest rank method, in O(1)
+ *
+ * @param ranking
+ * @param percentile From 0 to 100
+ * @return uint32_t The smallest total at least percentile percent of groups are less than or equal to
+ */
+inline uint32_t totalAtPercentile(const CalorieRanking *ranking, double percentile)
+{
+    double position = percentile / 100.0 * ranking->count;
+    size_t index = (size_t)position;
+
+    // Nearest rank rounds up, and index counts from 0
+    index -= index > 0 && index == position;
+    return ranking->sorted[std::min(index, ranking->count - 1)];
+}
+
+#endif /* DAY1_RANKING */
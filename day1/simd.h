@@ -0,0 +1,114 @@
+#ifndef DAY1_SIMD
+#define DAY1_SIMD
+
+#include <stdint.h>
+#include "swar.h"
+#include "newline.h"
+
+/*
+    Vector kernels for the calorie parser, only available on x86-64 hosts.
+    Each 64 byte block of the input is turned into a newline mask (see newline.h). Walking the set bits
+    gives every line end without following a chain of loads, and a newline directly after another marks
+    the end of an elf.
+*/
+
+#define CALORIE_VECTOR_KERNELS NEWLINE_VECTOR_MASKS
+
+#if CALORIE_VECTOR_KERNELS
+
+/**
+ * @brief Size of the blocks the vector kernels build newline masks for
+ */
+#define CALORIE_BLOCK NEWLINE_BLOCK
+
+/**
+ * @brief Parses a calorie list from newline masks, calling onGroup with the total of each elf.
+ * For each block, newlines & (newlines << 1 | carry) marks every newline that directly follows another,
+ * which are the empty lines between elves. The carry holds whether the previous block ended in a newline.
+ * Every other set bit ends a line, which is converted with the SWAR digit conversion.
+ * Blocks are only read while a full block and a word past it are left, so line loads need no bounds checks.
+ * The rest of the input is finished with the SWAR path. Groups are reported in input order.
+ * 
+ * @tparam NewlineMask Builds the newline mask for a block
+ * @tparam Total The type group totals are accumulated in
+ * @param start 
+ * @param end 
+ * @param onGroup 
+ */
+template <uint64_t (*NewlineMask)(const char *), typename Total, typename OnGroup>
+inline void parseCalorieBlocks(const char *start, const char *end, OnGroup &onGroup)
+{
+    CalorieCursor<Total> cursor = {start, end, 0};
+    const char *block = start;
+    // The input starts a line, so a newline in the first byte is an empty line
+    uint64_t carry = 1;
+
+    for (; end - block >= CALORIE_BLOCK + 8; block += CALORIE_BLOCK)
+    {
+        uint64_t newlines = NewlineMask(block);
+        uint64_t empties = newlines & ((newlines << 1) | carry);
+        carry = newlines >> 63;
+
+        while (newlines)
+        {
+            int bit = __builtin_ctzll(newlines);
+            const char *lineEnd = block + bit;
+
+            if ((empties >> bit) & 1)
+            {
+                // Two newlines in a row, next elf
+                onGroup(cursor.current);
+                cursor.current = 0;
+            }
+            else
+            {
+                uint64_t word;
+                memcpy(&word, cursor.position, 8);
+                cursor.current += parseLine<Total>(word, cursor.position, lineEnd);
+            }
+
+            cursor.position = lineEnd + 1;
+            newlines &= newlines - 1;
+        }
+    }
+
+    while (cursor.position < end)
+    {
+        nextLine(&cursor, loadWord(cursor.position, end), onGroup);
+    }
+
+    // Last elf, as the input doesn't end with a blank line
+    onGroup(cursor.current);
+}
+
+/**
+ * @brief Parses a calorie list using SSE2 newline masks
+ * 
+ * @param start 
+ * @param end 
+ * @param onGroup 
+ */
+template <typename Total = int, typename OnGroup>
+inline void parseCalorieGroupsSse2(const char *start, const char *end, OnGroup &onGroup)
+{
+    parseCalorieBlocks<newlineMaskSse2, Total>(start, end, onGroup);
+}
+
+/**
+ * @brief Parses a calorie list using AVX2 newline masks
+ * Flattened so the AVX2 mask is inlined into the block loop, which it can't be from
+ * the generic template on its own.
+ * 
+ * @param start 
+ * @param end 
+ * @param onGroup 
+ */
+template <typename Total = int, typename OnGroup>
+__attribute__((target("avx2"), flatten)) void parseCalorieGroupsAvx2(const char *start, const char *end, OnGroup &onGroup)
+{
+    parseCalorieBlocks<newlineMaskAvx2, Total>(start, end, onGroup);
+}
+
+#endif /* CALORIE_VECTOR_KERNELS */
+
+#endif /* DAY1_SIMD */
@@ -0,0 +1,150 @@
+#ifndef DAY1_STREAM
+#define DAY1_STREAM
+
+#include <stddef.h>
+#include <stdint.h>
+#include "calories.h"
+#include "topk.h"
+
+/*
+    Streaming calorie parser.
+    The input arrives in chunks of any size, so a line or an elf can be cut off at the end of any chunk.
+    Everything needed to resume is kept in CalorieStream between chunks, which keeps the memory used
+    constant no matter how large the input is.
+
+    Each chunk is split in three:
+     - The head, up to the first blank line, finishes the elf carried over from the previous chunk.
+     - The body, up to the last blank line, only holds whole elves and is handed to the fast kernels.
+     - The tail, after the last blank line, is an elf that may continue in the next chunk.
+    The head and tail are parsed one character at a time, which is cheap as they only cover a single elf.
+*/
+
+/**
+ * @brief State of a streaming calorie parse, carried between chunks
+ *
+ * @tparam K Number of the largest elves kept
+ */
+template <size_t K>
+struct CalorieStream
+{
+    // Total of the elf being read, without the line being read
+    int current;
+    // Value of the digits read so far on the line being read
+    uint32_t partial;
+    // Whether any characters have been read on the line being read, a newline otherwise ends the elf
+    bool inLine;
+    TopK<K> top;
+};
+
+/**
+ * @brief Parses characters one at a time, until the end or until an elf has been completed.
+ * Follows the same rules as the other parsers, every character other than a newline is taken as a digit.
+ *
+ * @param stream
+ * @param start
+ * @param end
+ * @param stopAtElf Whether to stop after the first completed elf
+ * @return const char* Position after the last character read
+ */
+template <size_t K>
+inline const char *feedCalorieCharacters(CalorieStream<K> &stream, const char *start, const char *end, bool stopAtElf)
+{
+    while (start < end)
+    {
+        char value = *(start++);
+
+        if (value != '\n')
+        {
+            stream.partial = stream.partial * 10 + (value - 48);
+            stream.inLine = true;
+        }
+        else if (stream.inLine)
+        {
+            stream.current += stream.partial;
+            stream.partial = 0;
+            stream.inLine = false;
+        }
+        else
+        {
+            // Two newlines in a row, next elf
+            pushTopK(stream.top, stream.current);
+            stream.current = 0;
+
+            if (stopAtElf)
+            {
+                break;
+            }
+        }
+    }
+    return start;
+}
+
+/**
+ * @brief Finds the end of the last whole elf in a chunk.
+ * That is the last non empty line followed by a blank line, so the kernels see exactly the same lines
+ * and report the same elves as a parse one character at a time.
+ *
+ * @param start
+ * @param end
+ * @return const char* The newline ending the elf's last line, or NULL if there is none
+ */
+inline const char *findLastElf(const char *start, const char *end)
+{
+    for (const char *position = end - 2; position > start; position--)
+    {
+        if (position[0] == '\n' && position[1] == '\n' && position[-1] != '\n')
+        {
+            return position;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Feeds the next chunk of input into a stream
+ *
+ * @param stream
+ * @param chunk
+ * @param length
+ */
+template <size_t K>
+inline void feedCalories(CalorieStream<K> &stream, const char *chunk, size_t length)
+{
+    const char *end = chunk + length;
+    const char *bodyStart = feedCalorieCharacters(stream, chunk, end, true);
+    const char *bodyEnd = findLastElf(bodyStart, end);
+
+    if (bodyEnd != NULL)
+    {
+        // The body starts and ends on an elf, and the kernels end the last elf for us
+        parseCalorieGroups(bodyStart, bodyEnd, [&](int current) {
+            pushTopK(stream.top, current);
+        });
+
+        bodyStart = bodyEnd + 2;
+    }
+
+    feedCalorieCharacters(stream, bodyStart, end, false);
+}
+
+/**
+ * @brief Ends the input, completing the last elf
+ *
+ * @param stream
+ */
+template <size_t K>
+inline void finishCalories(CalorieStream<K> &stream)
+{
+    if (stream.inLine)
+    {
+        stream.current += stream.partial;
+    }
+
+    pushTopK(stream.top, stream.current);
+
+    stream.current = 0;
+    stream.partial = 0;
+    stream.inLine = false;
+}
+
+#endif /* DAY1_STREAM */
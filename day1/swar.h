@@ -0,0 +1,367 @@
+#ifndef DAY1_SWAR
+#define DAY1_SWAR
+
+#include <stdint.h>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+
+/*
+    SWAR (SIMD within a register) calorie parser.
+    Input is loaded 8 bytes at a time into a 64 bit word, with the first character in the
+    lowest byte. This relies on a little endian target, which both the RP2040 and x86-64 are.
+*/
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error "The SWAR calorie parser expects a little endian target"
+#endif
+
+#define SWAR_ZEROS 0x3030303030303030ull
+
+/**
+ * @brief Loads up to 8 bytes starting at position without reading past end.
+ * Missing bytes are zero, which is never mistaken for a newline or a digit.
+ * 
+ * @param position 
+ * @param end 
+ * @return uint64_t 
+ */
+inline uint64_t loadWord(const char *position, const char *end)
+{
+    uint64_t word = 0;
+    if (end - position >= 8)
+    {
+        memcpy(&word, position, 8);
+    }
+    else
+    {
+        memcpy(&word, position, end - position);
+    }
+    return word;
+}
+
+/**
+ * @brief Flags the bytes in a word that could end a line.
+ * A calorie list only holds digits and newlines, and of those only a newline has bit 5 clear,
+ * so a single and-not finds them. Other characters with bit 5 clear, including the zero padding
+ * loadWord adds past the end, are flagged as well, so callers check the flagged byte really is a newline.
+ * 
+ * @param word 
+ * @return uint64_t A word with bit 5 set in each flagged byte
+ */
+inline uint64_t lineEndCandidates(uint64_t word)
+{
+    return ~word & 0x2020202020202020ull;
+}
+
+/**
+ * @brief Checks that every byte of a word is an ASCII digit
+ * 
+ * @param word Digits moved to the top of the word and padded with '0', as in alignDigits
+ * @return true 
+ * @return false 
+ */
+inline bool allDigits(uint64_t word)
+{
+    // A digit has a high nibble of 3, and adding 6 can't carry out of its low nibble
+    return ((((word & 0xF0F0F0F0F0F0F0F0ull) ^ SWAR_ZEROS) |
+             (((word + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) ^ SWAR_ZEROS)) == 0);
+}
+
+/**
+ * @brief Moves the first length bytes of a word to the top and pads the bottom with '0'.
+ * This lines the least significant digit up with the highest byte, so every number
+ * is converted as if it were 8 digits long.
+ * 
+ * @param word 
+ * @param length A length between 1 and 8
+ * @return uint64_t 
+ */
+inline uint64_t alignDigits(uint64_t word, int length)
+{
+    // Shifting in two steps avoids an undefined shift by 64 when length is 8
+    return (word << (8 * (8 - length))) | ((SWAR_ZEROS >> 1) >> (8 * length - 1));
+}
+
+/**
+ * @brief Converts 8 ASCII digits into their numeric value without looping over each digit.
+ * Pairs of digits are combined, then pairs of pairs, using multiplications that
+ * handle several lanes at once.
+ * 
+ * @param word 
+ * @return uint32_t 
+ */
+inline uint32_t parseDigits(uint64_t word)
+{
+    word -= SWAR_ZEROS;
+    word = (word * 10) + (word >> 8);
+    return (uint32_t)((((word & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+                       (((word >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32)))) >> 32);
+}
+
+/**
+ * @brief Number of cursors the calorie parser interleaves
+ */
+#define CALORIE_STREAMS 4
+
+/**
+ * @brief Converts a line of digits into its value one character at a time.
+ * Every character is treated as a digit, matching the original parser.
+ * The value is converted in the unsigned type matching Total, so a 64 bit total also reads lines of up to 19 digits.
+ * 
+ * @tparam Total The type group totals are accumulated in
+ * @param start 
+ * @param end 
+ * @return Total 
+ */
+template <typename Total = int>
+constexpr Total parseLineScalar(const char *start, const char *end)
+{
+    std::make_unsigned_t<Total> value = 0;
+    while (start < end)
+    {
+        value = value * 10 + (*(start++) - 48);
+    }
+    return value;
+}
+
+/**
+ * @brief Converts a line of digits into its value.
+ * Lines of up to 8 digits are converted from the word already loaded at the start of the line,
+ * everything else falls back to the scalar conversion.
+ * 
+ * @tparam Total The type group totals are accumulated in
+ * @param word The 8 bytes starting at the line
+ * @param start 
+ * @param end End of the line
+ * @return Total 
+ */
+template <typename Total = int>
+inline Total parseLine(uint64_t word, const char *start, const char *end)
+{
+    int length = end - start;
+
+    if (length <= 8)
+    {
+        uint64_t digits = alignDigits(word, length);
+        if (allDigits(digits))
+        {
+            return parseDigits(digits);
+        }
+    }
+
+    return parseLineScalar<Total>(start, end);
+}
+
+/**
+ * @brief Position of a parser within a calorie list, and the total of the elf it is reading
+ * 
+ * @tparam Total The type group totals are accumulated in, int unless inputs may overflow it
+ */
+template <typename Total = int>
+struct CalorieCursor
+{
+    const char *position;
+    const char *end;
+    Total current;
+};
+
+/**
+ * @brief Reads the next line under a cursor one character at a time.
+ * Handles everything the SWAR path can't: lines longer than a word, characters other than digits,
+ * and the last line of the input.
+ * 
+ * @param cursor 
+ * @param onGroup 
+ */
+template <typename Total, typename OnGroup>
+inline void nextLineScalar(CalorieCursor<Total> *cursor, OnGroup &onGroup)
+{
+    const char *position = cursor->position, *end = cursor->end;
+    const char *lineEnd = (const char *)memchr(position, '\n', end - position);
+
+    lineEnd = lineEnd == NULL ? end : lineEnd;
+
+    if (lineEnd == position)
+    {
+        // Two newlines in a row, next elf
+        onGroup(cursor->current);
+        cursor->current = 0;
+    }
+    else
+    {
+        cursor->current += parseLineScalar<Total>(position, lineEnd);
+    }
+
+    cursor->position = lineEnd + 1;
+}
+
+/**
+ * @brief Reads the next line under a cursor, calling onGroup if it ends an elf.
+ * The 8 bytes at the start of the line are loaded once. The first flagged byte gives the length
+ * of the line, and the same word is then converted with SWAR, so a line costs a single load and a
+ * handful of arithmetic regardless of how many digits it has. If the flagged byte isn't a newline,
+ * or the line isn't all digits, the line is read again with the scalar path.
+ * 
+ * @param cursor 
+ * @param word The 8 bytes starting at the cursor
+ * @param onGroup 
+ */
+template <typename Total, typename OnGroup>
+inline void nextLine(CalorieCursor<Total> *cursor, uint64_t word, OnGroup &onGroup)
+{
+    // With no flagged byte this checks the last byte, which can't be a newline either
+    int length = __builtin_ctzll(lineEndCandidates(word) | (1ull << 63)) >> 3;
+    bool newline = (uint8_t)(word >> (8 * length)) == '\n';
+
+    if (newline && length == 0)
+    {
+        // Two newlines in a row, next elf
+        onGroup(cursor->current);
+        cursor->current = 0;
+        cursor->position++;
+        return;
+    }
+
+    uint64_t digits = alignDigits(word, length | (length == 0));
+
+    if (newline && allDigits(digits))
+    {
+        cursor->current += parseDigits(digits);
+        cursor->position += length + 1;
+        return;
+    }
+
+    nextLineScalar(cursor, onGroup);
+}
+
+/**
+ * @brief Splits a calorie list into cursors that each start on an elf.
+ * Each split point is moved forward to the next blank line, so no elf is shared between cursors.
+ * A cursor ends on the newline of its last item, and cursors past the last blank line are left empty.
+ * 
+ * @param start 
+ * @param end 
+ * @param cursors 
+ * @param count 
+ */
+template <typename Total>
+inline void splitCalorieGroups(const char *start, const char *end, CalorieCursor<Total> cursors[], int count)
+{
+    const char *position = start;
+
+    for (int i = 0; i < count; i++)
+    {
+        const char *split = i == count - 1 ? end : std::max(position, start + (end - start) / count * (i + 1));
+
+        // Find the next blank line at or after the split
+        while (split < end)
+        {
+            split = (const char *)memchr(split, '\n', end - split);
+            if (split == NULL || split + 1 == end)
+            {
+                split = end;
+            }
+            else if (split[1] == '\n')
+            {
+                break;
+            }
+            else
+            {
+                split++;
+            }
+        }
+
+        cursors[i] = {position, split < end ? split + 1 : end, 0};
+        position = split < end ? split + 2 : end;
+    }
+}
+
+/**
+ * @brief Reads a line from each cursor in turn, starting at cursor I.
+ * Unrolled at compile time so each cursor can be kept in registers.
+ * 
+ * @param cursors Cursors with at least a word left before their end
+ * @param onGroup 
+ */
+template <int I = 0, typename Total, typename OnGroup>
+inline void nextLines(CalorieCursor<Total> cursors[], OnGroup &onGroup)
+{
+    uint64_t word;
+    memcpy(&word, cursors[I].position, 8);
+    nextLine(&cursors[I], word, onGroup);
+
+    if constexpr (I + 1 < CALORIE_STREAMS)
+    {
+        nextLines<I + 1>(cursors, onGroup);
+    }
+}
+
+/**
+ * @brief Checks every cursor from I on has a word left before its end
+ * 
+ * @param cursors 
+ * @return true 
+ * @return false 
+ */
+template <int I = 0, typename Total>
+inline bool wordsLeft(const CalorieCursor<Total> cursors[])
+{
+    if constexpr (I + 1 < CALORIE_STREAMS)
+    {
+        return (cursors[I].end - cursors[I].position >= 8) & wordsLeft<I + 1>(cursors);
+    }
+    return cursors[I].end - cursors[I].position >= 8;
+}
+
+/**
+ * @brief Parses a calorie list with SWAR, calling onGroup with the total of each elf.
+ * This is the portable path, and the reference the vector kernels are checked against.
+ * Following each line depends on finding the end of the last one, which would leave the processor
+ * waiting on a chain of loads. Instead the input is split at blank lines into CALORIE_STREAMS cursors
+ * and a line is read from each in turn, so their loads and conversions overlap. As a result groups
+ * are reported in no particular order.
+ * While every cursor has a full word left the loads need no bounds checks, the remaining lines of each
+ * cursor are then read with loads that stop at its end.
+ * 
+ * @tparam Total The type group totals are accumulated in
+ * @param start 
+ * @param end 
+ * @param onGroup Called with the total of each group
+ */
+template <typename Total = int, typename OnGroup>
+inline void parseCalorieGroupsSwar(const char *start, const char *end, OnGroup &onGroup)
+{
+    CalorieCursor<Total> splits[CALORIE_STREAMS], cursors[CALORIE_STREAMS];
+    bool empty[CALORIE_STREAMS];
+
+    splitCalorieGroups(start, end, splits, CALORIE_STREAMS);
+
+    for (int i = 0; i < CALORIE_STREAMS; i++)
+    {
+        // The first cursor always reports an elf, even for an empty input
+        empty[i] = i > 0 && splits[i].position >= splits[i].end;
+        cursors[i] = splits[i];
+    }
+
+    while (wordsLeft(cursors))
+    {
+        nextLines(cursors, onGroup);
+    }
+
+    for (int i = 0; i < CALORIE_STREAMS; i++)
+    {
+        while (cursors[i].position < cursors[i].end)
+        {
+            nextLine(&cursors[i], loadWord(cursors[i].position, cursors[i].end), onGroup);
+        }
+
+        // Last elf of the cursor, as it doesn't end with a blank line
+        if (!empty[i])
+        {
+            onGroup(cursors[i].current);
+        }
+    }
+}
+
+#endif /* DAY1_SWAR */
@@ -0,0 +1,168 @@
+#ifndef DAY1_TOPK
+#define DAY1_TOPK
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+
+/*
+    Top K selection over a stream of values.
+    Almost every value in a long stream is smaller than the current K largest, so each push starts by
+    comparing against the smallest value kept and rejects most values with a single, well predicted branch.
+    What happens to the few values that are accepted depends on K, and is picked at compile time:
+     - Small K keeps the values sorted and inserts with a fixed compare-exchange network, which the compiler
+       fully unrolls into branch free min/max operations.
+     - Large K keeps the values in a bounded min-heap, so an insert costs log K rather than K.
+*/
+
+/**
+ * @brief Largest K that is selected with the insertion network, larger K use the min-heap
+ */
+#define TOP_K_NETWORK_LIMIT 16
+
+/**
+ * @brief The K largest values seen so far.
+ * Starts out holding K zeros, as group totals are never negative.
+ * With the network the values are sorted smallest first, with the heap the smallest is the root.
+ * Either way the smallest value kept is values[0].
+ *
+ * @tparam K
+ * @tparam Total The type of the values, int unless group totals may overflow it
+ */
+template <size_t K, typename Total = int>
+struct TopK
+{
+    static_assert(K > 0, "TopK needs to keep at least one value");
+
+    Total values[K];
+};
+
+/**
+ * @brief Inserts a value into sorted values, dropping the smallest.
+ * Each position takes the larger of its own value and the smaller of the new value and the position above it,
+ * which shifts everything below the insertion point down by one without any branches.
+ *
+ * @param values Values sorted smallest first
+ * @param value A value larger than values[0]
+ */
+template <size_t K, typename Total>
+constexpr void insertTopKNetwork(Total (&values)[K], Total value)
+{
+    for (size_t i = 0; i + 1 < K; i++)
+    {
+        values[i] = std::max(values[i], std::min(value, values[i + 1]));
+    }
+    values[K - 1] = std::max(values[K - 1], value);
+}
+
+/**
+ * @brief Replaces the root of a min-heap, and sifts the new value down to where it belongs
+ *
+ * @param values A min-heap
+ * @param value A value larger than the root
+ */
+template <size_t K, typename Total>
+constexpr void insertTopKHeap(Total (&values)[K], Total value)
+{
+    size_t parent = 0;
+
+    while (true)
+    {
+        size_t child = 2 * parent + 1;
+
+        if (child >= K)
+        {
+            break;
+        }
+
+        // Follow the smaller child, which is the one that has to move up
+        child += child + 1 < K && values[child + 1] < values[child];
+
+        if (values[child] >= value)
+        {
+            break;
+        }
+
+        values[parent] = values[child];
+        parent = child;
+    }
+
+    values[parent] = value;
+}
+
+/**
+ * @brief Offers a value to the selector
+ *
+ * @param top
+ * @param value
+ */
+template <size_t K, typename Total>
+constexpr void pushTopK(TopK<K, Total> &top, Total value)
+{
+    if (value <= top.values[0])
+    {
+        return;
+    }
+
+    if constexpr (K <= TOP_K_NETWORK_LIMIT)
+    {
+        insertTopKNetwork(top.values, value);
+    }
+    else
+    {
+        insertTopKHeap(top.values, value);
+    }
+}
+
+/**
+ * @brief Sums the K largest values
+ *
+ * @param top
+ * @return Total
+ */
+template <size_t K, typename Total>
+constexpr Total sumTopK(const TopK<K, Total> &top)
+{
+    Total result = 0;
+
+    for (size_t i = 0; i < K; i++)
+    {
+        result += top.values[i];
+    }
+    return result;
+}
+
+/**
+ * @brief Merges the values kept by another selector into this one
+ *
+ * @param top
+ * @param other
+ */
+template <size_t K, typename Total>
+constexpr void mergeTopK(TopK<K, Total> &top, const TopK<K, Total> &other)
+{
+    for (size_t i = 0; i < K; i++)
+    {
+        pushTopK(top, other.values[i]);
+    }
+}
+
+/**
+ * @brief The largest value kept
+ *
+ * @param top
+ * @return Total
+ */
+template <size_t K, typename Total>
+constexpr Total maxTopK(const TopK<K, Total> &top)
+{
+    Total result = top.values[0];
+
+    for (size_t i = 1; i < K; i++)
+    {
+        result = std::max(result, top.values[i]);
+    }
+    return result;
+}
+
+#endif /* DAY1_TOPK */
@@ -1,8 +1,16 @@
 
 #include <stdio.h>
 #include <stdint.h> 
+#include <string.h>
 #include "pico/stdlib.h"
 #include "day2.h"
+#include "packed.h"
+#include "scoring.h"
+#include "text.h"
+#if !PICO_ON_DEVICE
+#include "parallel.h"
+#endif
+#include "answer.h"
 
 typedef struct {
     uint32_t win; 
@@ -37,7 +45,7 @@ typedef struct {
  * 
  * @return int 
  */
-int partOne(const uint32_t input[], uint32_t size)
+constexpr int partOne(const uint32_t input[], uint32_t size)
 {
     ResponseResult responseResults[RESPONSE_SIZE] =
     {
@@ -87,7 +95,7 @@ int partOne(const uint32_t input[], uint32_t size)
  * 
  * @return int 
  */
-int partTwo(const uint32_t input[], uint32_t size)
+constexpr int partTwo(const uint32_t input[], uint32_t size)
 {
     Strategy strategies[RESPONSE_SIZE] =
     {
@@ -113,20 +121,104 @@ int partTwo(const uint32_t input[], uint32_t size)
     return score;
 }
 
-#define ARRAY_SIZE(a) (sizeof((a)) / sizeof((a)[0]))
+/**
+ * @brief Part 1 of Day 2, over packed rounds
+ * Same rules as partOne, but rather than working out each round, every possible pair of rounds is
+ * scored ahead of time by the compiler. A byte of input holds a pair, which makes the score of two
+ * rounds a single table lookup.
+ *
+ * @return int
+ */
+constexpr int partOnePacked(PackedRounds input)
+{
+    return scorePackedPairs(input, PART_ONE_SCORES);
+}
+
+/**
+ * @brief Part 2 of Day 2, over packed rounds
+ * Same rules as partTwo, with a table of pairs generated from the part 2 rules.
+ *
+ * @return int
+ */
+constexpr int partTwoPacked(PackedRounds input)
+{
+    return scorePackedPairs(input, PART_TWO_SCORES);
+}
 
-int main()
+#ifndef AOC_NO_MAIN
+#if !PICO_ON_DEVICE
+/**
+ * @brief Solves both parts for a text input file, scoring the packed rounds on every core.
+ * Scores are added up in 64 bits, so any number of rounds that fits in memory once packed can be scored.
+ *
+ * @param path The input file, or "-" for stdin
+ * @return int 0 on success
+ */
+int solveParallel(const char *path)
 {
+    InputFile text = acquireInputFile(path);
+    PackedRounds rounds = text.view.data != NULL ? packTextRounds(text.view) : PackedRounds{};
+
+    if (rounds.words == NULL)
+    {
+        printf("Unable to read %s\n", path);
+        releaseInputFile(text);
+        return 1;
+    }
+
+    printf("---- Day 2 part 1 Parallel ----\n");
+    printf("Result: %llu\n", (unsigned long long)scoreRoundsParallel(rounds, PART_ONE_SCORES));
+    printf("---- Day 2 part 2 Parallel ----\n");
+    printf("Result: %llu\n", (unsigned long long)scoreRoundsParallel(rounds, PART_TWO_SCORES));
+
+    freePackedRounds(rounds);
+    releaseInputFile(text);
+    return 0;
+}
+#endif
+
+/**
+ * @brief Solves the embedded inputs, or the text input file named by the first argument instead of the actual input.
+ * Passing "-" reads the input from stdin, and on the host "--parallel <file>" scores it on every core.
+ * Answers for the embedded inputs may be folded at compile time.
+ */
+int main(int argc, char *argv[])
+{
+    bool parallel = !PICO_ON_DEVICE && argc > 2 && strcmp(argv[1], "--parallel") == 0;
+    InputView text = argc > 1 && !parallel ? readInputArgument(argv[1]) : InputView{};
+    PackedRounds actual = text.data != NULL ? packTextRounds(text) : PackedRounds{};
+
     stdio_init_all();
 
+#if !PICO_ON_DEVICE
+    if (parallel)
+    {
+        return solveParallel(argv[2]);
+    }
+#endif
+
+    if (argc > 1 && actual.words == NULL)
+    {
+        printf("Unable to read %s\n", argv[1]);
+        freeInput(text);
+        return 1;
+    }
+
     sleep_ms(1000);
 
     printf("---- Day 2 Part 1 Test  ----\n");
-    printf("Result: %d\n", partOne(TEST_INPUT, ARRAY_SIZE(TEST_INPUT)));
+    printf("Result: %d\n", AOC_ANSWER(partOnePacked, packedRounds(PACKED_TEST_INPUT)));
     printf("---- Day 2 Part 1  ----\n");
-    printf("Result: %d\n", partOne(ACTUAL_INPUT, ARRAY_SIZE(ACTUAL_INPUT)));
+    printf("Result: %d\n", argc > 1 ? partOnePacked(actual) : AOC_ANSWER(partOnePacked, packedRounds(PACKED_ACTUAL_INPUT)));
     printf("---- Day 2 part 2 Test ----\n");
-    printf("Result: %d\n", partTwo(TEST_INPUT, ARRAY_SIZE(TEST_INPUT)));
+    printf("Result: %d\n", AOC_ANSWER(partTwoPacked, packedRounds(PACKED_TEST_INPUT)));
     printf("---- Day 2 part 2 ----\n");
-    printf("Result: %d\n", partTwo(ACTUAL_INPUT, ARRAY_SIZE(ACTUAL_INPUT)));
+    printf("Result: %d\n", argc > 1 ? partTwoPacked(actual) : AOC_ANSWER(partTwoPacked, packedRounds(PACKED_ACTUAL_INPUT)));
+
+    if (argc > 1)
+    {
+        freePackedRounds(actual);
+        freeInput(text);
+    }
 }
+#endif /* AOC_NO_MAIN */
@@ -1,9 +1,8 @@
 #ifndef DAY2
 #define DAY2
 
-#define WIN 6
-#define DRAW 3
-#define LOSS 0
+#include "payoffs.h"
+#include "packed.h"
 
 enum MoveType
 {
@@ -21,13 +20,19 @@ enum ResponseType
     RESPONSE_SIZE
 };
 
-const uint32_t TEST_INPUT[] = {
+/*
+    Embedded inputs, written as a move and a response per round and packed by the compiler.
+    The rounds only exist as a temporary while the packed form is worked out, so whatever the build
+    type, only the packed words end up in flash.
+*/
+
+constexpr auto PACKED_TEST_INPUT = packRounds({
     A, Y,
     B, X,
     C, Z
-};
+});
 
-const uint32_t ACTUAL_INPUT[] = {
+constexpr auto PACKED_ACTUAL_INPUT = packRounds({
     C, X,
     B, Y,
     C, Z,
@@ -2528,6 +2533,6 @@ const uint32_t ACTUAL_INPUT[] = {
     A, X,
     C, Y,
     B, X
-};
+});
 
 #endif /* DAY2 */
@@ -0,0 +1,227 @@
+#ifndef DAY2_GAME
+#define DAY2_GAME
+
+#include <stddef.h>
+#include <stdint.h>
+#include "payoffs.h"
+
+/*
+    Payoff matrix games.
+    Rock Paper Scissors is one of many games where both players pick one of N moves, and the score
+    of a round is a score for the move played plus a payoff for how it fares against the other move.
+    A game is described at runtime by those scores, and a strategy maps an outcome the response asks
+    for to the move that causes it, like part 2 does.
+
+    Either is compiled once into a flat table indexed by a whole round, so scoring any game is the same
+    loop of one load and one add per round. A round takes a byte, the opponent's move in the high nibble
+    and the response in the low nibble, which allows up to 16 moves and 16 outcomes.
+*/
+
+/**
+ * @brief Largest number of moves, or outcomes, a game can have
+ */
+#define GAME_MAX_MOVES 16
+#define GAME_ROUND_BITS 4
+#define GAME_TABLE_SIZE (GAME_MAX_MOVES * GAME_MAX_MOVES)
+
+/**
+ * @brief Rules of a game
+ */
+typedef struct
+{
+    uint32_t moves;
+    // Score for playing each move
+    int32_t moveScores[GAME_MAX_MOVES];
+    // Score of the result of playing a move (row) against the opponent's move (column)
+    int32_t payoffs[GAME_MAX_MOVES][GAME_MAX_MOVES];
+} GameRules;
+
+/**
+ * @brief A strategy, the move played for each outcome asked for
+ */
+typedef struct
+{
+    uint32_t outcomes;
+    // Move played for an outcome (row) against the opponent's move (column)
+    uint8_t moves[GAME_MAX_MOVES][GAME_MAX_MOVES];
+} GameStrategy;
+
+/**
+ * @brief Score of every possible round of a game
+ */
+typedef struct
+{
+    int32_t scores[GAME_TABLE_SIZE];
+} GameTable;
+
+/**
+ * @brief Packs a round of a game into a byte
+ *
+ * @param opponent The opponent's move
+ * @param response The move played, or the outcome asked for
+ * @return uint8_t
+ */
+constexpr uint8_t packGameRound(uint32_t opponent, uint32_t response)
+{
+    return (uint8_t)((opponent << GAME_ROUND_BITS) | response);
+}
+
+/**
+ * @brief Builds the rules of a cyclic game with an odd number of moves, each move beating half of the others.
+ * A move beats another when the distance from it to the other, going down, is odd. With 3 moves that's
+ * Rock, Paper, Scissors, and with 5 it's Rock, Paper, Scissors, Spock, Lizard.
+ *
+ * @param moves
+ * @param rules
+ * @return true
+ * @return false If moves is even, or more than GAME_MAX_MOVES
+ */
+constexpr bool makeCyclicGame(uint32_t moves, GameRules &rules)
+{
+    if (moves % 2 == 0 || moves > GAME_MAX_MOVES)
+    {
+        return false;
+    }
+
+    rules = {};
+    rules.moves = moves;
+    for (uint32_t move = 0; move < moves; move++)
+    {
+        rules.moveScores[move] = move + 1;
+
+        for (uint32_t opponent = 0; opponent < moves; opponent++)
+        {
+            uint32_t distance = (move + moves - opponent) % moves;
+            rules.payoffs[move][opponent] = distance == 0 ? DRAW : distance % 2 ? WIN : LOSS;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Builds the strategy that causes each outcome, picking the highest scoring move when several do
+ *
+ * @param rules
+ * @param outcomePayoffs The payoff of each outcome
+ * @param outcomes
+ * @param strategy
+ * @return true
+ * @return false If an outcome can't be caused against some move
+ */
+constexpr bool deriveGameStrategy(const GameRules &rules, const int32_t outcomePayoffs[], uint32_t outcomes, GameStrategy &strategy)
+{
+    if (rules.moves > GAME_MAX_MOVES || outcomes > GAME_MAX_MOVES)
+    {
+        return false;
+    }
+
+    strategy = {};
+    strategy.outcomes = outcomes;
+
+    for (uint32_t outcome = 0; outcome < outcomes; outcome++)
+    {
+        for (uint32_t opponent = 0; opponent < rules.moves; opponent++)
+        {
+            bool found = false;
+
+            for (uint32_t move = 0; move < rules.moves; move++)
+            {
+                uint8_t &picked = strategy.moves[outcome][opponent];
+
+                if (rules.payoffs[move][opponent] == outcomePayoffs[outcome] &&
+                    (!found || rules.moveScores[move] > rules.moveScores[picked]))
+                {
+                    picked = (uint8_t)move;
+                    found = true;
+                }
+            }
+
+            if (!found)
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Compiles a game into a table of rounds where the response is the move played
+ *
+ * @param rules
+ * @param table
+ * @return true
+ * @return false If the game has too many moves
+ */
+constexpr bool compileGameTable(const GameRules &rules, GameTable &table)
+{
+    if (rules.moves > GAME_MAX_MOVES)
+    {
+        return false;
+    }
+
+    table = {};
+    for (uint32_t opponent = 0; opponent < rules.moves; opponent++)
+    {
+        for (uint32_t move = 0; move < rules.moves; move++)
+        {
+            table.scores[packGameRound(opponent, move)] = rules.moveScores[move] + rules.payoffs[move][opponent];
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Compiles a game into a table of rounds where the response is an outcome of the strategy
+ *
+ * @param rules
+ * @param strategy
+ * @param table
+ * @return true
+ * @return false If the game has too many moves, or the strategy plays a move the game doesn't have
+ */
+constexpr bool compileStrategyTable(const GameRules &rules, const GameStrategy &strategy, GameTable &table)
+{
+    if (rules.moves > GAME_MAX_MOVES || strategy.outcomes > GAME_MAX_MOVES)
+    {
+        return false;
+    }
+
+    table = {};
+    for (uint32_t opponent = 0; opponent < rules.moves; opponent++)
+    {
+        for (uint32_t outcome = 0; outcome < strategy.outcomes; outcome++)
+        {
+            uint32_t move = strategy.moves[outcome][opponent];
+
+            if (move >= rules.moves)
+            {
+                return false;
+            }
+
+            table.scores[packGameRound(opponent, outcome)] = rules.moveScores[move] + rules.payoffs[move][opponent];
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Scores rounds of a compiled game
+ *
+ * @param rounds Rounds packed with packGameRound
+ * @param count
+ * @param table
+ * @return int64_t
+ */
+constexpr int64_t scoreGameRounds(const uint8_t rounds[], size_t count, const GameTable &table)
+{
+    int64_t score = 0;
+
+    for (size_t round = 0; round < count; round++)
+    {
+        score += table.scores[rounds[round]];
+    }
+    return score;
+}
+
+#endif /* DAY2_GAME */
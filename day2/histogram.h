@@ -0,0 +1,237 @@
+#ifndef DAY2_HISTOGRAM
+#define DAY2_HISTOGRAM
+
+#include <stddef.h>
+#include <stdint.h>
+#include "constant.h"
+#include "cpu.h"
+#include "packed.h"
+#include "scoring.h"
+
+/*
+    Histogram scoring.
+    A round is one of only 9 combinations of move and response, so rather than scoring every round
+    the rounds are counted by their nibble, and the score is the dot product of the counts with the
+    score of each nibble. Counting doesn't depend on the rules, so one pass over the input answers
+    both parts, and the hot loop is nothing but counters.
+
+    On x86-64 hosts the counting is vectorized. Each byte of a block is split into its two rounds, and
+    every round is compared against each of the 9 combinations, subtracting the all ones result of the
+    compare from a vector of byte counters. The byte counters are summed into the histogram with a sum of
+    absolute differences before they can overflow.
+*/
+
+#if defined(__x86_64__)
+#define ROUND_VECTOR_COUNTING 1
+#include <immintrin.h>
+#else
+#define ROUND_VECTOR_COUNTING 0
+#endif
+
+/**
+ * @brief Number of valid combinations of move and response
+ */
+#define ROUND_COMBINATIONS 9
+
+/**
+ * @brief The nibble of each valid combination of move and response
+ */
+constexpr uint8_t ROUND_CODES[ROUND_COMBINATIONS] = {
+    packRound(0, 0), packRound(0, 1), packRound(0, 2),
+    packRound(1, 0), packRound(1, 1), packRound(1, 2),
+    packRound(2, 0), packRound(2, 1), packRound(2, 2)};
+
+/**
+ * @brief How often each packed round occurs, indexed by its nibble
+ */
+typedef struct
+{
+    uint64_t counts[16];
+} RoundHistogram;
+
+/**
+ * @brief Counts rounds one nibble at a time
+ *
+ * @param words
+ * @param first First round to count
+ * @param rounds Number of rounds in words
+ * @param histogram
+ */
+constexpr void countRoundsScalar(const uint32_t words[], size_t first, size_t rounds, RoundHistogram &histogram)
+{
+    for (size_t round = first; round < rounds; round++)
+    {
+        uint32_t word = words[round / PACKED_ROUNDS_PER_WORD];
+
+        histogram.counts[(word >> (PACKED_ROUND_BITS * (round % PACKED_ROUNDS_PER_WORD))) & PACKED_ROUND_MASK]++;
+    }
+}
+
+#if ROUND_VECTOR_COUNTING
+
+/**
+ * @brief Rounds counted per vector block
+ */
+#define ROUND_BLOCK_ROUNDS 64
+/**
+ * @brief Blocks counted before the byte counters are flushed, so no counter goes past 255.
+ * With AVX2 each block adds up to 2 to a counter, with SSE2 both halves of a block share the counters,
+ * which adds up to 4.
+ */
+#define ROUND_FLUSH_BLOCKS_AVX2 127
+#define ROUND_FLUSH_BLOCKS_SSE2 63
+
+/**
+ * @brief Counts whole 32 byte blocks of rounds with SSE2, two 16 byte halves at a time
+ *
+ * @param words
+ * @param blocks
+ * @param histogram
+ */
+inline void countRoundBlocksSse2(const uint32_t words[], size_t blocks, RoundHistogram &histogram)
+{
+    const __m128i low = _mm_set1_epi8(PACKED_ROUND_MASK);
+    const uint8_t *bytes = (const uint8_t *)words;
+
+    for (size_t block = 0; block < blocks;)
+    {
+        size_t flushAt = block + ROUND_FLUSH_BLOCKS_SSE2 < blocks ? block + ROUND_FLUSH_BLOCKS_SSE2 : blocks;
+        __m128i counters[ROUND_COMBINATIONS];
+
+        for (int code = 0; code < ROUND_COMBINATIONS; code++)
+        {
+            counters[code] = _mm_setzero_si128();
+        }
+
+        for (; block < flushAt; block++)
+        {
+            for (int half = 0; half < 2; half++)
+            {
+                __m128i packed = _mm_loadu_si128((const __m128i *)(bytes + 32 * block + 16 * half));
+                __m128i first = _mm_and_si128(packed, low);
+                __m128i second = _mm_and_si128(_mm_srli_epi16(packed, PACKED_ROUND_BITS), low);
+
+                for (int code = 0; code < ROUND_COMBINATIONS; code++)
+                {
+                    __m128i value = _mm_set1_epi8(ROUND_CODES[code]);
+                    counters[code] = _mm_sub_epi8(counters[code], _mm_cmpeq_epi8(first, value));
+                    counters[code] = _mm_sub_epi8(counters[code], _mm_cmpeq_epi8(second, value));
+                }
+            }
+        }
+
+        for (int code = 0; code < ROUND_COMBINATIONS; code++)
+        {
+            __m128i sums = _mm_sad_epu8(counters[code], _mm_setzero_si128());
+            histogram.counts[ROUND_CODES[code]] += (uint64_t)_mm_cvtsi128_si64(sums) +
+                                                   (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums));
+        }
+    }
+}
+
+/**
+ * @brief Counts whole 32 byte blocks of rounds with AVX2
+ *
+ * @param words
+ * @param blocks
+ * @param histogram
+ */
+__attribute__((target("avx2"))) inline void countRoundBlocksAvx2(const uint32_t words[], size_t blocks, RoundHistogram &histogram)
+{
+    const __m256i low = _mm256_set1_epi8(PACKED_ROUND_MASK);
+    const uint8_t *bytes = (const uint8_t *)words;
+
+    for (size_t block = 0; block < blocks;)
+    {
+        size_t flushAt = block + ROUND_FLUSH_BLOCKS_AVX2 < blocks ? block + ROUND_FLUSH_BLOCKS_AVX2 : blocks;
+        __m256i counters[ROUND_COMBINATIONS];
+
+        for (int code = 0; code < ROUND_COMBINATIONS; code++)
+        {
+            counters[code] = _mm256_setzero_si256();
+        }
+
+        for (; block < flushAt; block++)
+        {
+            __m256i packed = _mm256_loadu_si256((const __m256i *)(bytes + 32 * block));
+            __m256i first = _mm256_and_si256(packed, low);
+            __m256i second = _mm256_and_si256(_mm256_srli_epi16(packed, PACKED_ROUND_BITS), low);
+
+            for (int code = 0; code < ROUND_COMBINATIONS; code++)
+            {
+                __m256i value = _mm256_set1_epi8(ROUND_CODES[code]);
+                counters[code] = _mm256_sub_epi8(counters[code], _mm256_cmpeq_epi8(first, value));
+                counters[code] = _mm256_sub_epi8(counters[code], _mm256_cmpeq_epi8(second, value));
+            }
+        }
+
+        for (int code = 0; code < ROUND_COMBINATIONS; code++)
+        {
+            __m256i sums = _mm256_sad_epu8(counters[code], _mm256_setzero_si256());
+            histogram.counts[ROUND_CODES[code]] += (uint64_t)_mm256_extract_epi64(sums, 0) +
+                                                   (uint64_t)_mm256_extract_epi64(sums, 1) +
+                                                   (uint64_t)_mm256_extract_epi64(sums, 2) +
+                                                   (uint64_t)_mm256_extract_epi64(sums, 3);
+        }
+    }
+}
+
+/**
+ * @brief Whether countRounds uses the AVX2 kernel, detected at startup
+ */
+inline bool roundCountingAvx2 = cpuSupportsAvx2();
+
+#endif /* ROUND_VECTOR_COUNTING */
+
+/**
+ * @brief Counts how often each round occurs
+ *
+ * @param input
+ * @return RoundHistogram
+ */
+constexpr RoundHistogram countRounds(PackedRounds input)
+{
+    RoundHistogram histogram = {};
+    size_t first = 0;
+
+#if ROUND_VECTOR_COUNTING
+    if (!isConstantEvaluated())
+    {
+        // Only blocks made entirely of rounds, the padding of the last word would be counted as rounds
+        size_t blocks = input.rounds / ROUND_BLOCK_ROUNDS;
+
+        if (roundCountingAvx2)
+        {
+            countRoundBlocksAvx2(input.words, blocks, histogram);
+        }
+        else
+        {
+            countRoundBlocksSse2(input.words, blocks, histogram);
+        }
+        first = blocks * ROUND_BLOCK_ROUNDS;
+    }
+#endif
+
+    countRoundsScalar(input.words, first, input.rounds, histogram);
+    return histogram;
+}
+
+/**
+ * @brief Total score of counted rounds under one rule set, the dot product of the counts and the round scores
+ *
+ * @param histogram
+ * @param table
+ * @return uint64_t
+ */
+constexpr uint64_t scoreRoundHistogram(const RoundHistogram &histogram, const PairScoreTable &table)
+{
+    uint64_t score = 0;
+
+    for (int code = 0; code < ROUND_COMBINATIONS; code++)
+    {
+        score += histogram.counts[ROUND_CODES[code]] * table.rounds[ROUND_CODES[code]];
+    }
+    return score;
+}
+
+#endif /* DAY2_HISTOGRAM */
@@ -0,0 +1,112 @@
+#ifndef DAY2_PACKED
+#define DAY2_PACKED
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+    Packed rounds.
+    A move and a response only take 2 bits each, so a round fits in a nibble, with the move in the
+    high 2 bits and the response in the low 2 bits. Eight rounds are packed into each 32 bit word,
+    the first round in the lowest nibble, which is also the order they sit in memory on a little endian
+    core, two rounds to a byte.
+    That's half a byte per round instead of the 8 bytes taken by two uint32_t, and a single load fetches
+    eight rounds. The nibbles past the last round of the last word are left as 0, solvers stop at the
+    round count rather than relying on them.
+*/
+
+/**
+ * @brief Rounds packed into each word
+ */
+#define PACKED_ROUNDS_PER_WORD 8
+#define PACKED_ROUND_BITS 4
+#define PACKED_ROUND_MASK ((1u << PACKED_ROUND_BITS) - 1)
+
+/**
+ * @brief Number of words needed to pack a number of rounds
+ */
+#define PACKED_WORDS(rounds) (((rounds) + PACKED_ROUNDS_PER_WORD - 1) / PACKED_ROUNDS_PER_WORD)
+
+/**
+ * @brief A view of packed rounds
+ */
+typedef struct
+{
+    const uint32_t *words;
+    size_t rounds;
+} PackedRounds;
+
+/**
+ * @brief Storage for a fixed number of packed rounds, so inputs can be packed at compile time
+ *
+ * @tparam Rounds
+ */
+template <size_t Rounds>
+struct PackedRoundStorage
+{
+    uint32_t words[PACKED_WORDS(Rounds)];
+};
+
+/**
+ * @brief Packs a round into a nibble
+ *
+ * @param opponent MoveType of the opponent
+ * @param response ResponseType of the response
+ * @return uint32_t
+ */
+constexpr uint32_t packRound(uint32_t opponent, uint32_t response)
+{
+    return (opponent << 2) | response;
+}
+
+/**
+ * @brief Packs rounds given as a move and a response per round, as in day2.h
+ *
+ * @param input
+ * @param size Number of values in input, twice the number of rounds
+ * @param words Room for PACKED_WORDS(size / 2) words
+ */
+constexpr void packRoundsInto(const uint32_t input[], size_t size, uint32_t words[])
+{
+    size_t rounds = size / 2;
+
+    for (size_t word = 0; word < PACKED_WORDS(rounds); word++)
+    {
+        words[word] = 0;
+    }
+
+    for (size_t round = 0; round < rounds; round++)
+    {
+        words[round / PACKED_ROUNDS_PER_WORD] |=
+            packRound(input[2 * round], input[2 * round + 1]) << (PACKED_ROUND_BITS * (round % PACKED_ROUNDS_PER_WORD));
+    }
+}
+
+/**
+ * @brief Packs an embedded input at compile time
+ *
+ * @param input
+ * @return PackedRoundStorage<N / 2>
+ */
+template <size_t N>
+constexpr PackedRoundStorage<N / 2> packRounds(const uint32_t (&input)[N])
+{
+    PackedRoundStorage<N / 2> packed = {};
+
+    packRoundsInto(input, N, packed.words);
+    return packed;
+}
+
+/**
+ * @brief A view of rounds packed with packRounds
+ *
+ * @param packed
+ * @return PackedRounds
+ */
+template <size_t Rounds>
+constexpr PackedRounds packedRounds(const PackedRoundStorage<Rounds> &packed)
+{
+    return {packed.words, Rounds};
+}
+
+#endif /* DAY2_PACKED */
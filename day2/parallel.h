@@ -0,0 +1,71 @@
+#ifndef DAY2_PARALLEL
+#define DAY2_PARALLEL
+
+#include <stddef.h>
+#include <stdint.h>
+#include <algorithm>
+#include <thread>
+#include <vector>
+#include "threads.h"
+#include "packed.h"
+#include "scoring.h"
+
+/*
+    Multi-threaded scoring of packed rounds, for the host.
+    Rounds are independent of each other, so the packed words are simply cut into one slice per thread,
+    on word boundaries so no word is shared. Each thread scores its slice with the pair tables into a
+    64 bit score of its own, and the partial scores are added up at the end.
+*/
+
+/**
+ * @brief Smallest slice worth starting a thread for, 512 KiB of packed rounds
+ */
+#define ROUND_THREAD_ROUNDS (1 << 20)
+
+/**
+ * @brief Most threads scoring is split between
+ */
+#define ROUND_MAX_THREADS 64
+
+/**
+ * @brief Scores packed rounds using several threads
+ *
+ * @param input
+ * @param table The rules to score by, PART_ONE_SCORES or PART_TWO_SCORES
+ * @param threads Number of threads, including the calling thread. 0 uses every core, with at least ROUND_THREAD_ROUNDS each
+ * @return uint64_t
+ */
+inline uint64_t scoreRoundsParallel(PackedRounds input, const PairScoreTable &table, unsigned threads = 0)
+{
+    threads = threads == 0 ? workerThreads(input.rounds, ROUND_THREAD_ROUNDS, ROUND_MAX_THREADS)
+                           : std::min<unsigned>(threads, ROUND_MAX_THREADS);
+
+    size_t words = PACKED_WORDS(input.rounds);
+    std::vector<uint64_t> partials(threads, 0);
+    std::vector<std::thread> workers;
+
+    auto score = [&](unsigned i) {
+        size_t firstWord = words * i / threads, lastWord = words * (i + 1) / threads;
+        // Only the last slice may end part way through a word
+        size_t rounds = std::min(lastWord * PACKED_ROUNDS_PER_WORD, input.rounds) - firstWord * PACKED_ROUNDS_PER_WORD;
+
+        partials[i] = firstWord < lastWord ? scorePackedPairs<uint64_t>({input.words + firstWord, rounds}, table) : 0;
+    };
+
+    for (unsigned i = 1; i < threads; i++)
+    {
+        workers.emplace_back(score, i);
+    }
+    score(0);
+
+    uint64_t result = partials[0];
+
+    for (unsigned i = 1; i < threads; i++)
+    {
+        workers[i - 1].join();
+        result += partials[i];
+    }
+    return result;
+}
+
+#endif /* DAY2_PARALLEL */
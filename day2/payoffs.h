@@ -0,0 +1,11 @@
+#ifndef DAY2_PAYOFFS
+#define DAY2_PAYOFFS
+
+/**
+ * @brief Score of the outcome of a round
+ */
+#define WIN 6
+#define DRAW 3
+#define LOSS 0
+
+#endif /* DAY2_PAYOFFS */
@@ -0,0 +1,161 @@
+#ifndef DAY2_SCORING
+#define DAY2_SCORING
+
+#include <stddef.h>
+#include <stdint.h>
+#include "packed.h"
+
+/*
+    Scoring of packed rounds.
+    With the moves and responses numbered 0 to 2 the score of a round is simple arithmetic on its
+    nibble, which is used to generate lookup tables at compile time. A table indexed by a whole byte
+    scores the two rounds packed in it with a single load, so a word of eight rounds takes four lookups
+    and no branches. The tables only take a byte per entry, 256 bytes per rule set.
+*/
+
+/**
+ * @brief Score of a packed round under the rules of part 1.
+ * The result of a round is the difference between the response and the move, modulo 3. One more than
+ * the difference gives 0 for a loss, 1 for a draw and 2 for a win, which times 3 is the score of the result.
+ *
+ * @param round
+ * @return uint32_t
+ */
+constexpr uint32_t scoreRoundOne(uint32_t round)
+{
+    uint32_t opponent = round >> 2, response = round & 3;
+
+    return response + 1 + 3 * ((response + 4 - opponent) % 3);
+}
+
+/**
+ * @brief Score of a packed round under the rules of part 2.
+ * The response is the result, 0 to 2 for a loss, draw or win, so it gives the score of the result directly.
+ * The move that causes it is the opponent's move shifted by the result, one below it for a loss, and one above it for a win.
+ *
+ * @param round
+ * @return uint32_t
+ */
+constexpr uint32_t scoreRoundTwo(uint32_t round)
+{
+    uint32_t opponent = round >> 2, result = round & 3;
+
+    return (opponent + result + 2) % 3 + 1 + 3 * result;
+}
+
+/**
+ * @brief Scores of every packed round and pair of rounds under one rule set
+ */
+typedef struct
+{
+    // Score of both rounds packed in a byte
+    uint8_t pairs[256];
+    // Score of a single round, for a round count that isn't even
+    uint8_t rounds[16];
+} PairScoreTable;
+
+/**
+ * @brief Generates the lookup tables of a rule set
+ *
+ * @param scoreRound Scores a single round from its nibble
+ * @return PairScoreTable
+ */
+template <typename ScoreRound>
+constexpr PairScoreTable makePairScoreTable(ScoreRound scoreRound)
+{
+    PairScoreTable table = {};
+
+    for (uint32_t round = 0; round < 16; round++)
+    {
+        table.rounds[round] = (uint8_t)scoreRound(round);
+    }
+
+    for (uint32_t pair = 0; pair < 256; pair++)
+    {
+        table.pairs[pair] = (uint8_t)(table.rounds[pair & PACKED_ROUND_MASK] + table.rounds[pair >> PACKED_ROUND_BITS]);
+    }
+    return table;
+}
+
+constexpr PairScoreTable PART_ONE_SCORES = makePairScoreTable(scoreRoundOne);
+constexpr PairScoreTable PART_TWO_SCORES = makePairScoreTable(scoreRoundTwo);
+
+/**
+ * @brief Scores packed rounds one nibble at a time
+ *
+ * @param input
+ * @param scoreRound Scores a single round from its nibble
+ * @return uint32_t
+ */
+template <typename ScoreRound>
+constexpr uint32_t scorePackedRounds(PackedRounds input, ScoreRound scoreRound)
+{
+    size_t fullWords = input.rounds / PACKED_ROUNDS_PER_WORD;
+    uint32_t score = 0;
+
+    for (size_t word = 0; word < fullWords; word++)
+    {
+        uint32_t rounds = input.words[word];
+
+        for (int round = 0; round < PACKED_ROUNDS_PER_WORD; round++)
+        {
+            score += scoreRound(rounds & PACKED_ROUND_MASK);
+            rounds >>= PACKED_ROUND_BITS;
+        }
+    }
+
+    // The last word may only be partly filled
+    uint32_t rounds = fullWords < PACKED_WORDS(input.rounds) ? input.words[fullWords] : 0;
+
+    for (size_t round = fullWords * PACKED_ROUNDS_PER_WORD; round < input.rounds; round++)
+    {
+        score += scoreRound(rounds & PACKED_ROUND_MASK);
+        rounds >>= PACKED_ROUND_BITS;
+    }
+
+    return score;
+}
+
+/**
+ * @brief Scores packed rounds two at a time with a lookup table
+ *
+ * @tparam Score The type the score is accumulated in, a 64 bit score for inputs that may overflow 32 bits
+ * @param input
+ * @param table
+ * @return Score
+ */
+template <typename Score = uint32_t>
+constexpr Score scorePackedPairs(PackedRounds input, const PairScoreTable &table)
+{
+    size_t fullWords = input.rounds / PACKED_ROUNDS_PER_WORD;
+    Score score = 0;
+
+    for (size_t word = 0; word < fullWords; word++)
+    {
+        uint32_t rounds = input.words[word];
+
+        score += table.pairs[rounds & 0xFF] +
+                 table.pairs[(rounds >> 8) & 0xFF] +
+                 table.pairs[(rounds >> 16) & 0xFF] +
+                 table.pairs[rounds >> 24];
+    }
+
+    // The last word may only be partly filled, and may end on half a pair
+    size_t remaining = input.rounds - fullWords * PACKED_ROUNDS_PER_WORD;
+    uint32_t rounds = remaining > 0 ? input.words[fullWords] : 0;
+
+    for (; remaining >= 2; remaining -= 2)
+    {
+        score += table.pairs[rounds & 0xFF];
+        rounds >>= 8;
+    }
+
+    if (remaining > 0)
+    {
+        score += table.rounds[rounds & PACKED_ROUND_MASK];
+    }
+
+    return score;
+}
+
+#endif /* DAY2_SCORING */
@@ -0,0 +1,128 @@
+#ifndef DAY2_TEXT
+#define DAY2_TEXT
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "input.h"
+#include "packed.h"
+
+/*
+    Raw text input.
+    The puzzle input is a line of exactly 4 bytes per round, "A Y\n", so the move and response of
+    round i are always at bytes 4i and 4i + 2 and no searching for line ends is needed.
+    A 64 bit load reads two lines. Subtracting 'A' and 'X' from the bytes holding the moves and responses
+    turns them into the numbers 0 to 2 in place, without borrows, after which both rounds are shifted
+    into nibbles with a few masks and shifts. Four loads fill a packed word of eight rounds, which is
+    then scored with the packed solvers. The last line may be missing its newline.
+*/
+
+/**
+ * @brief Bytes per line of text input
+ */
+#define TEXT_LINE_BYTES 4
+
+/**
+ * @brief Subtracted from two lines to turn the moves and responses into numbers
+ */
+#define TEXT_LINE_PAIR_BASE 0x0058004100580041ull
+
+/**
+ * @brief Number of rounds in text input
+ *
+ * @param input
+ * @return size_t
+ */
+inline size_t countTextRounds(InputView input)
+{
+    return (input.length + 1) / TEXT_LINE_BYTES;
+}
+
+/**
+ * @brief Packs two lines of text into a byte of two rounds
+ *
+ * @param lines
+ * @return uint32_t
+ */
+inline uint32_t packTextLinePair(const char *lines)
+{
+    uint64_t word;
+    memcpy(&word, lines, 8);
+
+    // Bytes 0 and 4 hold the moves, bytes 2 and 6 the responses
+    uint64_t values = (word - TEXT_LINE_PAIR_BASE) & 0x0003000300030003ull;
+    uint64_t rounds = (values << 2) | (values >> 16);
+
+    return (uint32_t)((rounds & PACKED_ROUND_MASK) | ((rounds >> 28) & (PACKED_ROUND_MASK << PACKED_ROUND_BITS)));
+}
+
+/**
+ * @brief Packs text input into rounds
+ *
+ * @param input
+ * @param words Room for PACKED_WORDS(countTextRounds(input)) words
+ */
+inline void packTextRoundsInto(InputView input, uint32_t words[])
+{
+    const char *text = input.data;
+    size_t rounds = countTextRounds(input);
+    // Whole words whose lines are all there, newlines included, so the loads stay inside the input
+    size_t fullWords = input.length / (TEXT_LINE_BYTES * PACKED_ROUNDS_PER_WORD);
+
+    for (size_t word = 0; word < fullWords; word++)
+    {
+        const char *lines = text + word * TEXT_LINE_BYTES * PACKED_ROUNDS_PER_WORD;
+
+        words[word] = packTextLinePair(lines) |
+                      packTextLinePair(lines + 8) << 8 |
+                      packTextLinePair(lines + 16) << 16 |
+                      packTextLinePair(lines + 24) << 24;
+    }
+
+    if (fullWords < PACKED_WORDS(rounds))
+    {
+        words[fullWords] = 0;
+    }
+
+    for (size_t round = fullWords * PACKED_ROUNDS_PER_WORD; round < rounds; round++)
+    {
+        const char *line = text + round * TEXT_LINE_BYTES;
+
+        words[round / PACKED_ROUNDS_PER_WORD] |=
+            packRound(line[0] - 'A', line[2] - 'X') << (PACKED_ROUND_BITS * (round % PACKED_ROUNDS_PER_WORD));
+    }
+}
+
+/**
+ * @brief Packs text input into newly allocated rounds
+ *
+ * @param input
+ * @return PackedRounds No rounds if memory ran out, release it with freePackedRounds
+ */
+inline PackedRounds packTextRounds(InputView input)
+{
+    size_t rounds = countTextRounds(input);
+    // One spare byte, so an empty input still gets a buffer
+    uint32_t *words = (uint32_t *)malloc(PACKED_WORDS(rounds) * sizeof(uint32_t) + 1);
+
+    if (words == NULL)
+    {
+        return {NULL, 0};
+    }
+
+    packTextRoundsInto(input, words);
+    return {words, rounds};
+}
+
+/**
+ * @brief Releases rounds returned by packTextRounds
+ *
+ * @param rounds
+ */
+inline void freePackedRounds(PackedRounds rounds)
+{
+    free((void *)rounds.words);
+}
+
+#endif /* DAY2_TEXT */
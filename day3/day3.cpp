@@ -3,6 +3,10 @@
 #include <stdint.h>
 #include "pico/stdlib.h"
 #include "day3.h"
+#include "items.h"
+#include "lines.h"
+#include "input.h"
+#include "answer.h"
 #include <cstring>
 
 /*
@@ -35,13 +39,14 @@ typedef struct
 
 /**
  * @brief Converts a string buffer into individual characters into bits
- * Uses two 32bit integers to store both the upper and lowercase characters
+ * Uses two 32bit integers to store both the upper and lowercase characters.
+ * Superseded by calculateItemMask, kept as the baseline it is benchmarked against
  *
  * @param start
  * @param end
  * @return CharacterBits
  */
-inline CharacterBits calculateBits(const char *start, const char *end)
+constexpr CharacterBits calculateBits(const char *start, const char *end)
 {
     CharacterBits result{0, 0};
     while (start < end)
@@ -54,15 +59,16 @@ inline CharacterBits calculateBits(const char *start, const char *end)
 }
 
 /**
- * @brief Sums all the enabled bits in a 32 bit integer
+ * @brief Sums all the enabled bits in an integer
  * The sum will add their position in the integer
- * Supply a base to offset the sum
+ * Supply a base to offset the sum.
+ * Superseded by sumItemPriorities, kept as the baseline it is benchmarked against
  *
  * @param duplicates
  * @param base
  * @return int
  */
-inline int sumBitPositions(uint32_t duplicates, int base = 1)
+constexpr int sumBitPositions(uint64_t duplicates, int base = 1)
 {
     int result = 0;
     while (duplicates > 0)
@@ -79,19 +85,17 @@ inline int sumBitPositions(uint32_t duplicates, int base = 1)
  * The value be represented by lowercase a-z being assigned 1-26, and uppercase A-Z being assigned 27-52
  * @param start
  * @param end
+ * @param limit End of the input
  * @return int
  */
-inline int calculateRucksuckDuplicates(const char *start, const char *end)
+constexpr int calculateRucksuckDuplicates(const char *start, const char *end, const char *limit)
 {
 
-    const char *mid;
-    CharacterBits first, second;
-    mid = ((end - start) >> 1) + start;
-    first = calculateBits(start, mid);
-    second = calculateBits(mid, end);
+    const char *mid = ((end - start) >> 1) + start;
+    uint64_t first = buildItemMask(start, mid, limit);
+    uint64_t second = buildItemMask(mid, end, limit);
 
-    return sumBitPositions((first.lower & second.lower) >> 1) +
-           sumBitPositions((first.upper & second.upper) >> 1, 27);
+    return sumItemPriorities(first & second);
 }
 
 /**
@@ -99,36 +103,33 @@ inline int calculateRucksuckDuplicates(const char *start, const char *end)
  * and will return a value representing that character.
  * The value be represented by lowercase a-z being assigned 1-26, and uppercase A-Z being assigned 27-52
  * @param start 
+ * @param end End of the input
  * @return int 
  */
-inline int calculateGroupBadge(const char **start)
+constexpr int calculateGroupBadge(const char **start, const char *end)
 {
-    const char *startOne, *endOne, *startTwo, *endTwo, *startThree, *endThree;
+    const char *startOne = *start;
+    const char *endOne = findChar(startOne, end, '\n');
 
-    startOne = *start;
-    endOne = strchr(startOne, '\n');
+    const char *startTwo = endOne + 1;
+    const char *endTwo = findChar(startTwo, end, '\n');
 
-    startTwo = endOne + 1;
-    endTwo = strchr(startTwo, '\n');
-
-    startThree = endTwo + 1;
-    endThree = strchr(startThree, '\n');
+    const char *startThree = endTwo + 1;
+    const char *endThree = findChar(startThree, end, '\n');
 
     if (endThree == NULL)
     {
-        endThree = strchr(startThree, '\0');
+        endThree = end;
     }
 
-    *start = endThree + 1;
-
-    CharacterBits first, second, third;
+    // Stay on the end after the last group so we never read past the input
+    *start = endThree == end ? end : endThree + 1;
 
-    first = calculateBits(startOne, endOne);
-    second = calculateBits(startTwo, endTwo);
-    third = calculateBits(startThree, endThree);
+    uint64_t first = buildItemMask(startOne, endOne, end);
+    uint64_t second = buildItemMask(startTwo, endTwo, end);
+    uint64_t third = buildItemMask(startThree, endThree, end);
 
-    return sumBitPositions((first.lower & second.lower & third.lower) >> 1) +
-           sumBitPositions((first.upper & second.upper & third.upper) >> 1, 27);
+    return sumItemPriorities(first & second & third);
 }
 
 /**
@@ -147,21 +148,22 @@ inline int calculateGroupBadge(const char **start)
  * store a "hashtable" of both the upper and lower case characters separately. I can then perform an & operator to compare 
  * the "hastable" of each section of rucksack, which will give me a resulting "hashtable" of all duplicates.
  * I can then calculate the duplicate character by finding the position of the flagged bit, and returning a value based off its position
-
+ * 
+ * @param input 
  * @return int
  */
-int partOne(const char input[])
+constexpr int partOne(InputView input)
 {
     int result = 0;
-    const char *start = input, *end;
+    const char *start = input.data, *end = NULL, *last = input.data + input.length;
 
-    while ((end = strchr(start, '\n')) != NULL)
+    while ((end = findChar(start, last, '\n')) != NULL)
     {
-        result += calculateRucksuckDuplicates(start, end);
+        result += calculateRucksuckDuplicates(start, end, last);
         start = end + 1;
     }
 
-    result += calculateRucksuckDuplicates(start, strchr(start, '\0'));
+    result += calculateRucksuckDuplicates(start, last, last);
 
     return result;
 }
@@ -179,32 +181,100 @@ int partOne(const char input[])
  * To solve Part 2 I employed the same "hashing" algorithm as Part 1, but instead of comparing the each section of a single
  * rucksack I compare 3 entire rucksacks. The solution follows the same algorithms for "hashing" and calculating the resulting value
  * of the duplicate item.
+ * @param input 
+ * @return int
+ */
+constexpr int partTwo(InputView input)
+{
+    int result = 0;
+    const char *start = input.data, *last = input.data + input.length;
+
+    while (findChar(start, last, '\n') != NULL)
+    {
+        result += calculateGroupBadge(&start, last);
+    }
+    return result;
+}
+
+/**
+ * @brief Part 1 of Day 3, over an index of the input's lines
+ * Same as partOne, but the line ends come from the index rather than searching for them.
+ *
+ * @param lines
  * @return int
  */
-int partTwo(const char input[])
+inline int partOneIndexed(const LineIndex *lines)
 {
+    const char *last = lines->input.data + lines->input.length;
     int result = 0;
-    const char *start = input, *end;
 
-    while ((end = strchr(start, '\n')) != NULL)
+    for (size_t line = 0; line < lines->count; line++)
     {
-        result += calculateGroupBadge(&start);
+        result += calculateRucksuckDuplicates(lineStart(lines, line), lineEnd(lines, line), last);
     }
     return result;
 }
 
-int main()
+/**
+ * @brief Part 2 of Day 3, over an index of the input's lines
+ * Same as partTwo, each group being the next 3 lines of the index.
+ *
+ * @param lines
+ * @return int
+ */
+inline int partTwoIndexed(const LineIndex *lines)
 {
+    const char *last = lines->input.data + lines->input.length;
+    int result = 0;
+
+    for (size_t line = 0; line + 2 < lines->count; line += 3)
+    {
+        uint64_t first = buildItemMask(lineStart(lines, line), lineEnd(lines, line), last);
+        uint64_t second = buildItemMask(lineStart(lines, line + 1), lineEnd(lines, line + 1), last);
+        uint64_t third = buildItemMask(lineStart(lines, line + 2), lineEnd(lines, line + 2), last);
+
+        result += sumItemPriorities(first & second & third);
+    }
+    return result;
+}
+
+#ifndef AOC_NO_MAIN
+/**
+ * @brief Solves the embedded inputs, or the input file named by the first argument instead of the actual input.
+ * Passing "-" reads the input from stdin. Answers for the embedded inputs may be folded at compile time.
+ */
+int main(int argc, char *argv[])
+{
+    constexpr InputView test = inputView(TEST_INPUT);
+    constexpr InputView embedded = inputView(ACTUAL_INPUT);
+    InputView actual = argc > 1 ? readInputArgument(argv[1]) : embedded;
+    // Input files are indexed once, and both parts walk the index
+    LineIndex lines = argc > 1 && actual.data != NULL ? buildLineIndex(actual) : LineIndex{};
+
     stdio_init_all();
 
+    if (actual.data == NULL || (argc > 1 && lines.offsets == NULL))
+    {
+        printf("Unable to read %s\n", argv[1]);
+        freeInput(actual);
+        return 1;
+    }
+
     sleep_ms(2000);
 
     printf("---- Day 3 part 1 Test ----\n");
-    printf("Result: %d\n", partOne(TEST_INPUT));
+    printf("Result: %d\n", AOC_ANSWER(partOne, test));
     printf("---- Day 3 part 1 ----\n");
-    printf("Result: %d\n", partOne(ACTUAL_INPUT));
+    printf("Result: %d\n", argc > 1 ? partOneIndexed(&lines) : AOC_ANSWER(partOne, embedded));
     printf("---- Day 3 part 2 Test ----\n");
-    printf("Result: %d\n", partTwo(TEST_INPUT));
+    printf("Result: %d\n", AOC_ANSWER(partTwo, test));
     printf("---- Day 3 part 2 ----\n");
-    printf("Result: %d\n", partTwo(ACTUAL_INPUT));
-}
\ No newline at end of file
+    printf("Result: %d\n", argc > 1 ? partTwoIndexed(&lines) : AOC_ANSWER(partTwo, embedded));
+
+    if (argc > 1)
+    {
+        freeLineIndex(&lines);
+        freeInput(actual);
+    }
+}
+#endif /* AOC_NO_MAIN */
@@ -1,14 +1,14 @@
 #ifndef DAY3
 #define DAY3
 
-const char* TEST_INPUT = "vJrwpWtwJgWrhcsFMMfFFhFp\n\
+constexpr char TEST_INPUT[] = "vJrwpWtwJgWrhcsFMMfFFhFp\n\
 jqHRNqRjqzjGDLGLrsFMfFZSrLrFZsSL\n\
 PmmdzqPrVvPwwTWBwg\n\
 wMqvLMZHhHMvwLHjbvcjnnSBnvTQFn\n\
 ttgJtRGJQctTZtZT\n\
 CrZsJsPPZsGzwwsLwLmpwMDw";
 
-const char* ACTUAL_INPUT = "mmbclcsDHCflDDlCrzzrDWjPJvjPvqJPjfpqZQdfWd\n\
+constexpr char ACTUAL_INPUT[] = "mmbclcsDHCflDDlCrzzrDWjPJvjPvqJPjfpqZQdfWd\n\
 NNFLnFRNhgNQtMLSFSgwSwGJPZWLPvjpjjJGZJPvWPvJ\n\
 BnwFNgVVhwNwVQrmzbrrCHVTmDsm\n\
 CTsVssjPTWPbzhfbfqqpbqJq\n\
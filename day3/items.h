@@ -0,0 +1,173 @@
+#ifndef DAY3_ITEMS
+#define DAY3_ITEMS
+
+#include <stdint.h>
+#include "bits.h"
+#include "constant.h"
+#include "cpu.h"
+#include "simd.h"
+
+/*
+    Item masks.
+    There are 52 item types, so a set of items fits in a single 64 bit mask with the bit of each item
+    at its priority, a-z at bits 1 to 26 and A-Z at bits 27 to 52. The priority of every character is
+    looked up in a table generated at compile time, which makes adding an item one load, one shift and
+    one OR, without any comparisons.
+    Characters that aren't items, like a carriage return, have a priority of 0 and only ever set bit 0,
+    which never holds an item.
+
+    As the bits sit at their priority, the priority of a single item is its count of trailing zeros.
+    The priorities of several items add up from their bits: bit k of a priority is set for the items
+    within ITEM_POSITION_MASKS[k], so the sum is the number of items within each mask times 2^k.
+*/
+
+/**
+ * @brief Priority of every character, 0 for characters that aren't items
+ */
+typedef struct
+{
+    uint8_t values[256];
+} ItemPriorities;
+
+/**
+ * @brief Generates the priority table
+ *
+ * @return ItemPriorities
+ */
+constexpr ItemPriorities makeItemPriorities()
+{
+    ItemPriorities priorities = {};
+
+    for (int item = 0; item < 26; item++)
+    {
+        priorities.values['a' + item] = (uint8_t)(item + 1);
+        priorities.values['A' + item] = (uint8_t)(item + 27);
+    }
+    return priorities;
+}
+
+constexpr ItemPriorities ITEM_PRIORITIES = makeItemPriorities();
+
+/**
+ * @brief Builds the mask of the items between start and end
+ *
+ * @param start
+ * @param end
+ * @return uint64_t A bit per item type at its priority, bit 0 may be set by characters that aren't items
+ */
+constexpr uint64_t calculateItemMask(const char *start, const char *end)
+{
+    uint64_t mask = 0;
+
+    while (start < end)
+    {
+        uint8_t value = *(start++);
+        mask |= 1ull << ITEM_PRIORITIES.values[value];
+    }
+    return mask;
+}
+
+/**
+ * @brief Number of bits needed to hold the position of any bit of a 64 bit mask
+ */
+#define ITEM_POSITION_BITS 6
+
+/**
+ * @brief The positions of a 64 bit mask with each bit of the position set
+ */
+constexpr uint64_t ITEM_POSITION_MASKS[ITEM_POSITION_BITS] = {
+    0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+    0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+/**
+ * @brief Sums the priorities of the items in a mask
+ * Puzzle inputs only ever have a single duplicate, which is found with one count of trailing zeros,
+ * otherwise every priority is summed at once with a population count per position bit.
+ *
+ * @param items
+ * @return int
+ */
+constexpr int sumItemPriorities(uint64_t items)
+{
+    // Bit 0 doesn't hold an item
+    items &= ~1ull;
+
+    if ((items & (items - 1)) == 0)
+    {
+        return items != 0 ? countTrailingZeros(items) : 0;
+    }
+
+    int result = 0;
+
+    for (int bit = 0; bit < ITEM_POSITION_BITS; bit++)
+    {
+        result += popCount(items & ITEM_POSITION_MASKS[bit]) << bit;
+    }
+    return result;
+}
+
+/**
+ * @brief The ways buildItemMask can build a mask, slowest first as detectKernel expects
+ */
+enum ItemKernel
+{
+    ITEM_KERNEL_SCALAR,
+    ITEM_KERNEL_AVX2,
+    ITEM_KERNEL_SIZE
+};
+
+/**
+ * @brief Name of each item kernel, as printed by the benchmark
+ */
+inline const char *ITEM_KERNEL_NAMES[ITEM_KERNEL_SIZE] = {"scalar", "avx2"};
+
+/**
+ * @brief Checks whether an item kernel was compiled in and can run on this processor
+ *
+ * @param kernel
+ * @return true
+ * @return false
+ */
+inline bool itemKernelSupported(ItemKernel kernel)
+{
+    switch (kernel)
+    {
+    case ITEM_KERNEL_SCALAR:
+        return true;
+#if ITEM_VECTOR_KERNELS
+    case ITEM_KERNEL_AVX2:
+        return cpuSupportsAvx2();
+#endif
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief The kernel buildItemMask runs at runtime, set to the fastest supported one
+ */
+inline ItemKernel itemKernel = detectKernel(ITEM_KERNEL_SIZE, itemKernelSupported);
+
+/**
+ * @brief Builds the mask of the items between start and end with the detected kernel, in a way the compiler can evaluate.
+ * The vector kernel reads whole blocks past end, so it's only used when they are within the input,
+ * the last few lines of an input are left to the scalar kernel.
+ *
+ * @param start
+ * @param end
+ * @param limit End of the input
+ * @return uint64_t A bit per item type at its priority, bit 0 may be set by characters that aren't items
+ */
+constexpr uint64_t buildItemMask(const char *start, const char *end, const char *limit)
+{
+#if ITEM_VECTOR_KERNELS
+    if (!isConstantEvaluated() && itemKernel == ITEM_KERNEL_AVX2 &&
+        limit - start >= (end - start + ITEM_BLOCK - 1) / ITEM_BLOCK * ITEM_BLOCK)
+    {
+        return calculateItemMaskAvx2(start, end);
+    }
+#endif
+    return calculateItemMask(start, end);
+}
+
+#endif /* DAY3_ITEMS */
@@ -0,0 +1,174 @@
+#ifndef DAY3_LINES
+#define DAY3_LINES
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "input.h"
+#include "bits.h"
+#include "newline.h"
+#include "cpu.h"
+
+/*
+    Line index.
+    Every rucksack is a line, and both parts, along with anything else asked of the input, only need
+    to know where each line starts and how long it is. The index finds every line end in a single pass
+    and keeps them, so each query walks the index instead of searching the input for newlines again.
+    When the processor supports AVX2 newlines are found 64 characters at a time from a newline mask,
+    otherwise with memchr.
+*/
+
+#if NEWLINE_VECTOR_MASKS
+/**
+ * @brief Whether buildLineIndex scans for newlines with AVX2, detected at startup
+ */
+inline bool lineScanAvx2 = cpuSupportsAvx2();
+#endif
+
+/**
+ * @brief Lines the index starts out with room for, it doubles whenever it runs out
+ */
+#define LINE_INDEX_CAPACITY 1024
+
+/**
+ * @brief Where every line of an input starts, and how long it is
+ */
+typedef struct
+{
+    // The indexed input, lines point into it
+    InputView input;
+    // Offset of the start of each line
+    size_t *offsets;
+    // Length of each line, without its newline
+    uint32_t *lengths;
+    size_t count;
+} LineIndex;
+
+/**
+ * @brief Appends a line to an index, growing it when it's full
+ *
+ * @param lines
+ * @param capacity Number of lines the index has room for
+ * @param offset
+ * @param length
+ * @return true
+ * @return false If memory ran out
+ */
+inline bool appendLine(LineIndex *lines, size_t *capacity, size_t offset, size_t length)
+{
+    if (lines->count == *capacity)
+    {
+        size_t *offsets = (size_t *)realloc(lines->offsets, 2 * *capacity * sizeof(size_t));
+        lines->offsets = offsets != NULL ? offsets : lines->offsets;
+
+        uint32_t *lengths = (uint32_t *)realloc(lines->lengths, 2 * *capacity * sizeof(uint32_t));
+        lines->lengths = lengths != NULL ? lengths : lines->lengths;
+
+        if (offsets == NULL || lengths == NULL)
+        {
+            return false;
+        }
+        *capacity *= 2;
+    }
+
+    lines->offsets[lines->count] = offset;
+    lines->lengths[lines->count] = (uint32_t)length;
+    lines->count++;
+    return true;
+}
+
+/**
+ * @brief Indexes every line of an input in one pass.
+ * There is always one more line than there are newlines, the last line may be empty.
+ *
+ * @param input
+ * @return LineIndex An index with no lines if memory ran out, release it with freeLineIndex
+ */
+inline LineIndex buildLineIndex(InputView input)
+{
+    size_t capacity = LINE_INDEX_CAPACITY, position = 0, lineStart = 0;
+    LineIndex lines = {input, (size_t *)malloc(capacity * sizeof(size_t)), (uint32_t *)malloc(capacity * sizeof(uint32_t)), 0};
+    bool failed = lines.offsets == NULL || lines.lengths == NULL;
+
+#if NEWLINE_VECTOR_MASKS
+    if (lineScanAvx2)
+    {
+        for (; !failed && input.length - position >= NEWLINE_BLOCK; position += NEWLINE_BLOCK)
+        {
+            uint64_t newlines = newlineMaskAvx2(input.data + position);
+
+            while (newlines && !failed)
+            {
+                size_t lineEnd = position + countTrailingZeros(newlines);
+
+                failed = !appendLine(&lines, &capacity, lineStart, lineEnd - lineStart);
+                lineStart = lineEnd + 1;
+                newlines &= newlines - 1;
+            }
+        }
+    }
+#endif
+
+    const char *newline = NULL;
+
+    while (!failed && (newline = (const char *)memchr(input.data + position, '\n', input.length - position)) != NULL)
+    {
+        size_t lineEnd = newline - input.data;
+
+        failed = !appendLine(&lines, &capacity, lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+        position = lineStart;
+    }
+
+    // The last line has no newline
+    failed = failed || !appendLine(&lines, &capacity, lineStart, input.length - lineStart);
+
+    if (failed)
+    {
+        free(lines.offsets);
+        free(lines.lengths);
+        return {input, NULL, NULL, 0};
+    }
+    return lines;
+}
+
+/**
+ * @brief Releases an index returned by buildLineIndex
+ *
+ * @param lines
+ */
+inline void freeLineIndex(LineIndex *lines)
+{
+    free(lines->offsets);
+    free(lines->lengths);
+    lines->offsets = NULL;
+    lines->lengths = NULL;
+    lines->count = 0;
+}
+
+/**
+ * @brief Start of a line
+ *
+ * @param lines
+ * @param line
+ * @return const char*
+ */
+inline const char *lineStart(const LineIndex *lines, size_t line)
+{
+    return lines->input.data + lines->offsets[line];
+}
+
+/**
+ * @brief End of a line, its newline or the end of the input
+ *
+ * @param lines
+ * @param line
+ * @return const char*
+ */
+inline const char *lineEnd(const LineIndex *lines, size_t line)
+{
+    return lineStart(lines, line) + lines->lengths[line];
+}
+
+#endif /* DAY3_LINES */
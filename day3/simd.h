@@ -0,0 +1,91 @@
+#ifndef DAY3_SIMD
+#define DAY3_SIMD
+
+#include <stdint.h>
+
+/*
+    Vector kernels for item masks, only available on x86-64 hosts.
+    Letters all have 4 to 7 as their high nibble, so subtracting '@' turns every letter into a slot
+    from 0 to 63, which is a bit of a 64 bit mask. Slots are worked out for 32 characters at once,
+    with characters that aren't letters and characters past the end of the compartment sent to slot 0,
+    which isn't a letter. The slots are then widened to 64 bits, four at a time, to be shifted into a
+    bit each and ORed together in vector registers.
+    The letters are ordered differently in slots than by priority, A-Z at slots 1 to 26 and a-z at 33
+    to 58, so the finished slot mask is rearranged into an item mask with two shifts.
+*/
+
+#if defined(__x86_64__)
+#define ITEM_VECTOR_KERNELS 1
+#include <immintrin.h>
+#else
+#define ITEM_VECTOR_KERNELS 0
+#endif
+
+#if ITEM_VECTOR_KERNELS
+
+/**
+ * @brief Characters the vector kernel reads at a time
+ */
+#define ITEM_BLOCK 32
+
+/**
+ * @brief The slots holding the letters of either case, bits 1 to 26
+ */
+#define ITEM_SLOT_LETTERS 0x7FFFFFEull
+
+/**
+ * @brief Rearranges a mask of slots into a mask of items, a-z moving down to bits 1 to 26 and A-Z up to bits 27 to 52
+ *
+ * @param slots
+ * @return uint64_t
+ */
+inline uint64_t itemsFromSlots(uint64_t slots)
+{
+    return ((slots >> 32) & ITEM_SLOT_LETTERS) | ((slots & ITEM_SLOT_LETTERS) << 26);
+}
+
+/**
+ * @brief Builds the mask of the items between start and end, 32 characters at a time with AVX2.
+ * Reads whole blocks of 32 characters, so the input has to continue up to the end of the last block.
+ *
+ * @param start
+ * @param end
+ * @return uint64_t A bit per item type at its priority
+ */
+__attribute__((target("avx2"))) inline uint64_t calculateItemMaskAvx2(const char *start, const char *end)
+{
+    const __m256i ones = _mm256_set1_epi64x(1);
+    const __m256i lanes = _mm256_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+                                           16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31);
+    __m256i result = _mm256_setzero_si256();
+
+    for (; start < end; start += ITEM_BLOCK)
+    {
+        __m256i bytes = _mm256_loadu_si256((const __m256i *)start);
+        __m256i remaining = _mm256_set1_epi8((char)(end - start < ITEM_BLOCK ? end - start : ITEM_BLOCK));
+        // Bytes from 0x80 up are negative, so this keeps '@' and above up to 0x7F
+        __m256i keep = _mm256_and_si256(_mm256_cmpgt_epi8(remaining, lanes),
+                                        _mm256_cmpgt_epi8(bytes, _mm256_set1_epi8('@' - 1)));
+        __m256i slots = _mm256_and_si256(_mm256_sub_epi8(bytes, _mm256_set1_epi8('@')), keep);
+        __m128i low = _mm256_castsi256_si128(slots);
+        __m128i high = _mm256_extracti128_si256(slots, 1);
+
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(low)));
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(_mm_srli_si128(low, 4))));
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(_mm_srli_si128(low, 8))));
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(_mm_srli_si128(low, 12))));
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(high)));
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(_mm_srli_si128(high, 4))));
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(_mm_srli_si128(high, 8))));
+        result = _mm256_or_si256(result, _mm256_sllv_epi64(ones, _mm256_cvtepu8_epi64(_mm_srli_si128(high, 12))));
+    }
+
+    __m128i halves = _mm_or_si128(_mm256_castsi256_si128(result), _mm256_extracti128_si256(result, 1));
+
+    return itemsFromSlots((uint64_t)_mm_cvtsi128_si64(halves) |
+                          (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(halves, halves)));
+}
+
+#endif /* ITEM_VECTOR_KERNELS */
+
+#endif /* DAY3_SIMD */
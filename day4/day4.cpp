@@ -3,6 +3,8 @@
 #include <stdint.h>
 #include "pico/stdlib.h"
 #include "day4.h"
+#include "input.h"
+#include "answer.h"
 #include <cstring>
 
 /** 
@@ -37,7 +39,7 @@ enum ValueState {
  * @return true 
  * @return false 
  */
-inline bool calculateFullOverlap(int firstLower, int firstUpper, int secondLower, int secondUpper)
+constexpr bool calculateFullOverlap(int firstLower, int firstUpper, int secondLower, int secondUpper)
 {
     return (
         (firstLower <= secondLower && firstUpper >= secondUpper) ||
@@ -58,7 +60,7 @@ inline bool calculateFullOverlap(int firstLower, int firstUpper, int secondLower
  * @return true 
  * @return false 
  */
-inline bool calculatePartialOverlap(int firstLower, int firstUpper, int secondLower, int secondUpper)
+constexpr bool calculatePartialOverlap(int firstLower, int firstUpper, int secondLower, int secondUpper)
 {
     return (
         (firstLower >= secondLower && firstLower <= secondUpper) ||
@@ -76,21 +78,19 @@ inline bool calculatePartialOverlap(int firstLower, int firstUpper, int secondLo
  * Potentially I could look at better ways for handling the state management, however I do like how it makes the code very readable.
  * I don't like how often I need to reset the section and radix on different lines, but I'm not to worried with the implementation
  * 
+ * @param input 
  * @return int
  */
-int partOne(const char input[])
+constexpr int partOne(InputView input)
 {
     int radix = 1;
-    size_t inputLength = strlen(input) - 1;
+    size_t inputLength = input.length - 1;
 
     ParserState parserState = IDLE;
     ValueState valueState = FIRST_UPPER;
 
-    int count, firstUpper, firstLower,
-        secondUpper, secondLower, section;
-    
-
-    count = section = 0;
+    int count = 0, firstUpper = 0, firstLower = 0,
+        secondUpper = 0, secondLower = 0, section = 0;
 
     /*
     Loop through entire Input from back to front.
@@ -100,7 +100,7 @@ int partOne(const char input[])
     for (int i = inputLength; i >= 0; i--)
     {
         // Read the next character
-        char value = input[i];
+        char value = input.data[i];
 
         /* 
         Update the state based off the read character
@@ -178,21 +178,19 @@ int partOne(const char input[])
  * 
  * The same as part 1, however a new comparison function is utlized to only check partial overlaps.
  * 
+ * @param input 
  * @return int
  */
-int partTwo(const char input[])
+constexpr int partTwo(InputView input)
 {
     int radix = 1;
-    size_t inputLength = strlen(input) - 1;
+    size_t inputLength = input.length - 1;
 
     ParserState parserState = IDLE;
     ValueState valueState = FIRST_UPPER;
 
-    int count, firstUpper, firstLower,
-        secondUpper, secondLower, section;
-    
-
-    count = section = 0;
+    int count = 0, firstUpper = 0, firstLower = 0,
+        secondUpper = 0, secondLower = 0, section = 0;
 
     /*
     Loop through entire Input from back to front.
@@ -202,7 +200,7 @@ int partTwo(const char input[])
     for (int i = inputLength; i >= 0; i--)
     {
         // Read the next character
-        char value = input[i];
+        char value = input.data[i];
 
         /* 
         Update the state based off the read character
@@ -272,18 +270,39 @@ int partTwo(const char input[])
     return count;
 }
 
-int main()
+#ifndef AOC_NO_MAIN
+/**
+ * @brief Solves the embedded inputs, or the input file named by the first argument instead of the actual input.
+ * Passing "-" reads the input from stdin. Answers for the embedded inputs may be folded at compile time.
+ */
+int main(int argc, char *argv[])
 {
+    constexpr InputView test = inputView(TEST_INPUT);
+    constexpr InputView embedded = inputView(ACTUAL_INPUT);
+    InputView actual = argc > 1 ? readInputArgument(argv[1]) : embedded;
+
     stdio_init_all();
 
+    if (actual.data == NULL)
+    {
+        printf("Unable to read %s\n", argv[1]);
+        return 1;
+    }
+
     sleep_ms(2000);
 
     printf("---- Day 4 part 1 Test ----\n");
-    printf("Result: %d\n", partOne(TEST_INPUT));
+    printf("Result: %d\n", AOC_ANSWER(partOne, test));
     printf("---- Day 4 part 1 ----\n");
-    printf("Result: %d\n", partOne(ACTUAL_INPUT));
+    printf("Result: %d\n", argc > 1 ? partOne(actual) : AOC_ANSWER(partOne, embedded));
     printf("---- Day 4 part 2 Test ----\n");
-    printf("Result: %d\n", partTwo(TEST_INPUT));
+    printf("Result: %d\n", AOC_ANSWER(partTwo, test));
     printf("---- Day 4 part 2 ----\n");
-    printf("Result: %d\n", partTwo(ACTUAL_INPUT));
-}
\ No newline at end of file
+    printf("Result: %d\n", argc > 1 ? partTwo(actual) : AOC_ANSWER(partTwo, embedded));
+
+    if (argc > 1)
+    {
+        freeInput(actual);
+    }
+}
+#endif /* AOC_NO_MAIN */
@@ -1,14 +1,14 @@
 #ifndef DAY4
 #define DAY4
 
-const char* TEST_INPUT = "2-4,6-8\n\
+constexpr char TEST_INPUT[] = "2-4,6-8\n\
 2-3,4-5\n\
 5-7,7-9\n\
 2-8,3-7\n\
 6-6,4-6\n\
 2-6,4-8";
 
-const char* ACTUAL_INPUT = "8-17,16-49\n\
+constexpr char ACTUAL_INPUT[] = "8-17,16-49\n\
 17-38,18-36\n\
 17-43,43-43\n\
 86-94,7-87\n\
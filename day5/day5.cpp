@@ -4,6 +4,7 @@
 #include <stdint.h>
 #include "pico/stdlib.h"
 #include "day5.h"
+#include "input.h"
 #include <cstring>
 #include <vector>
 
@@ -27,6 +28,12 @@ typedef struct {
     int count, from, to;
 } Instruction;
 
+/**
+ * @brief Size of the buffer main uses to report the top of each stack, inputs can have up to RESULT_SIZE - 1 stacks
+ * 
+ */
+#define RESULT_SIZE 64
+
 /**
  * @brief State for managing which part of the insutruction is being read.
  * 
@@ -57,9 +64,9 @@ enum ReadLineState {
  * @param numberOfColumns A pointer to an integer to store the number of columns
  * @return int An index pointing to a position after the stack input
  */
-int loadStacks(const char input[], Stack*** stacks, int *numberOfColumns)
+int loadStacks(InputView input, Stack*** stacks, int *numberOfColumns)
 {
-    char* endOfLine = strchr(input, '\n');
+    const char* endOfLine = (const char*) memchr(input.data, '\n', input.length);
 
     if (endOfLine == NULL)
     {
@@ -70,13 +77,13 @@ int loadStacks(const char input[], Stack*** stacks, int *numberOfColumns)
     size_t stacksSize;
 
     // Calculating Line length and column count
-    lineEnd = (endOfLine - input) + 1;
+    lineEnd = (endOfLine - input.data) + 1;
     lineLength = lineEnd;
     *numberOfColumns = lineLength >> 2;
 
-    // Calculating and allocating memory
+    // Calculating and allocating memory, stacks without boxes start out empty
     stacksSize = sizeof(Stack_t*) * (*numberOfColumns);
-    *stacks = (Stack**) malloc(stacksSize);
+    *stacks = (Stack**) calloc(*numberOfColumns, sizeof(Stack_t*));
     
     // Temp pointers for filling out start
     // These will point to the bottom of each stack
@@ -87,20 +94,20 @@ int loadStacks(const char input[], Stack*** stacks, int *numberOfColumns)
 
     index = 0;
 
-    while(input[index] != '\n')
+    while(input.data[index] != '\n')
     {
         column = 0;
         // Read entire line
         for (;index < lineLength;)
         {
             // A box exists on this stack
-            if (input[index] == '[')
+            if (input.data[index] == '[')
             {
-                char value = input[++index];
+                char value = input.data[++index];
                 // Either allocate a new stack start, or add to a previous stack
                 builders[column] = builders[column] == NULL ? 
-                    (*stacks)[column] = (Stack*) malloc(sizeof(Stack_t*)) : 
-                    builders[column]->below = (Stack*) malloc(sizeof(Stack_t*));
+                    (*stacks)[column] = (Stack*) malloc(sizeof(Stack_t)) : 
+                    builders[column]->below = (Stack*) malloc(sizeof(Stack_t));
                 
                 *builders[column] = { value, NULL };
                 // We already incremented once, so we only need to move 3 more
@@ -114,7 +121,7 @@ int loadStacks(const char input[], Stack*** stacks, int *numberOfColumns)
             column++;
         }
         // Incrememnt our line end position
-        lineLength += (lineEnd + 1);
+        lineLength += lineEnd;
     }
 
     return index += 2;
@@ -139,6 +146,7 @@ inline void parseSequentialInstruction(Instruction instruction, Stack **stacks)
         temp = from->below;
         from->below = to;
         to = from;
+        from = temp;
     }
 
     stacks[instruction.to] = to;
@@ -219,9 +227,25 @@ inline Instruction readInstruction(const char *position)
     return Instruction;
 }
 
+/**
+ * @brief Copies the value of the top box of each stack into a string
+ * 
+ * @param stacks 
+ * @param stackCount 
+ * @param result Buffer with room for stackCount characters and a terminator
+ */
+void readTops(Stack** stacks, int stackCount, char result[])
+{
+    for (int i = 0; i < stackCount; i++)
+    {
+        result[i] = stacks[i] == NULL ? ' ' : stacks[i]->value;
+    }
+    result[stackCount] = '\0';
+}
+
 void freeStacks(Stack** stacks, int stackCount)
 {
-    for (size_t i = 0; i < stackCount; i++)
+    for (int i = 0; i < stackCount; i++)
     {
         Stack* stack = stacks[i], *temp;
         while (stack != NULL)
@@ -242,46 +266,56 @@ void freeStacks(Stack** stacks, int stackCount)
  * initial orientation of the stacks, and then perform each operation on these stacks. Each box has an assigned letter, and 
  * our solution is printing out the letter from the top box of each stack.
  * 
+ * The letters are written into result, and the number of stacks is returned.
+ * 
  * I solved this one by utilizing linked lists to act as a FILO queue, where I can load the stacks in each queue. I build the number of 
  * queues by calculating the number of stacks from the line length. Afterwards I then perform each action sequentially by
  * moving each box one by one from 1 queue to another. When loading in the initial state I load it in from the top to the bottom.
  * I did this to make it easier to read as I could just read top the bottom. However I did need to keep two lots of pointers,
  * one for the top, and one for the bottom.
  * 
- * @return int
+ * @param input The AOC input
+ * @param result Buffer that receives the top box of each stack
+ * @param resultSize Size of result, including the terminator
+ * @return int The number of stacks, -1 if the input couldn't be read or has more stacks than result has room for
  */
-int partOne(const char input[])
+int partOne(InputView input, char result[], int resultSize)
 {
     Stack** stacks;
     int numberOfColumns, start;
 
     start = loadStacks(input, &stacks, &numberOfColumns);
 
-    size_t inputLength = strlen(input) - 1;
+    if (start < 0)
+    {
+        return -1;
+    }
 
-    const char* endOfLine = input + start;
+    if (numberOfColumns >= resultSize)
+    {
+        freeStacks(stacks, numberOfColumns);
+        return -1;
+    }
+
+    const char* endOfLine = input.data + start;
+    const char* endOfInput = input.data + input.length;
 
 
-    while ((endOfLine = strchr(endOfLine, '\n')) != NULL)
+    while ((endOfLine = (const char*) memchr(endOfLine, '\n', endOfInput - endOfLine)) != NULL)
     {
         Instruction instruction = readInstruction(endOfLine++);
         parseSequentialInstruction(instruction, stacks);
 
     }
 
-    Instruction instruction = readInstruction(input + inputLength + 1);
+    Instruction instruction = readInstruction(endOfInput);
     parseSequentialInstruction(instruction, stacks);
 
-    for (size_t i = 0; i < numberOfColumns; i++)
-    {
-        Stack* stack = stacks[i];
-        printf("%c", stacks[i]->value);
-    }
-    printf("\n");
+    readTops(stacks, numberOfColumns, result);
 
     freeStacks(stacks, numberOfColumns);
 
-    return 0;
+    return numberOfColumns;
 }
 
 /**
@@ -295,54 +329,99 @@ int partOne(const char input[])
  * Part two is the exact same as part 1, however I just needed to change the instruction parser from a 1 by 1 operation to
  * a single batched operation. 
  * 
- * @return int
+ * @param input The AOC input
+ * @param result Buffer that receives the top box of each stack
+ * @param resultSize Size of result, including the terminator
+ * @return int The number of stacks, -1 if the input couldn't be read or has more stacks than result has room for
  */
-int partTwo(const char input[])
+int partTwo(InputView input, char result[], int resultSize)
 {
     Stack** stacks;
     int numberOfColumns, start;
 
     start = loadStacks(input, &stacks, &numberOfColumns);
 
-    size_t inputLength = strlen(input) - 1;
+    if (start < 0)
+    {
+        return -1;
+    }
+
+    if (numberOfColumns >= resultSize)
+    {
+        freeStacks(stacks, numberOfColumns);
+        return -1;
+    }
 
-    const char* endOfLine = input + start;
+    const char* endOfLine = input.data + start;
+    const char* endOfInput = input.data + input.length;
 
 
-    while ((endOfLine = strchr(endOfLine, '\n')) != NULL)
+    while ((endOfLine = (const char*) memchr(endOfLine, '\n', endOfInput - endOfLine)) != NULL)
     {
         Instruction instruction = readInstruction(endOfLine++);
         parseBatchedInstruction(instruction, stacks);
 
     }
 
-    Instruction instruction = readInstruction(input + inputLength + 1);
+    Instruction instruction = readInstruction(endOfInput);
     parseBatchedInstruction(instruction, stacks);
 
-    for (size_t i = 0; i < numberOfColumns; i++)
-    {
-        Stack* stack = stacks[i];
-        printf("%c", stacks[i]->value);
-    }
-    printf("\n");
+    readTops(stacks, numberOfColumns, result);
 
     freeStacks(stacks, numberOfColumns);
 
-    return 0;
+    return numberOfColumns;
+}
+
+#ifndef AOC_NO_MAIN
+/**
+ * @brief Prints the tops of the stacks found by a part, or why there aren't any
+ * 
+ * @param stackCount The value returned by the part
+ * @param result 
+ */
+void printTops(int stackCount, const char result[])
+{
+    if (stackCount < 0)
+    {
+        printf("Unable to solve, inputs can have at most %d stacks\n", RESULT_SIZE - 1);
+        return;
+    }
+    printf("Result: %s\n", result);
 }
 
-int main()
+/**
+ * @brief Solves the embedded inputs, or the input file named by the first argument instead of the actual input.
+ * Passing "-" reads the input from stdin.
+ */
+int main(int argc, char *argv[])
 {
+    char result[RESULT_SIZE];
+    InputView test = inputView(TEST_INPUT);
+    InputView actual = argc > 1 ? readInputArgument(argv[1]) : inputView(ACTUAL_INPUT);
+
     stdio_init_all();
 
+    if (actual.data == NULL)
+    {
+        printf("Unable to read %s\n", argv[1]);
+        return 1;
+    }
+
     sleep_ms(2000);
 
     printf("\n\n---- Day 5 part 1 Test ----\n");
-    printf("Result: %d\n", partOne(TEST_INPUT));
+    printTops(partOne(test, result, RESULT_SIZE), result);
     printf("---- Day 5 part 1 ----\n");
-    printf("Result: %d\n", partOne(ACTUAL_INPUT));
+    printTops(partOne(actual, result, RESULT_SIZE), result);
     printf("---- Day 5 part 2 Test ----\n");
-    printf("Result: %d\n", partTwo(TEST_INPUT));
+    printTops(partTwo(test, result, RESULT_SIZE), result);
     printf("---- Day 5 part 2 ----\n");
-    printf("Result: %d\n", partTwo(ACTUAL_INPUT));
-}
\ No newline at end of file
+    printTops(partTwo(actual, result, RESULT_SIZE), result);
+
+    if (argc > 1)
+    {
+        freeInput(actual);
+    }
+}
+#endif /* AOC_NO_MAIN */
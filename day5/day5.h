@@ -1,7 +1,7 @@
 #ifndef DAY5
 #define DAY5
 
-const char* TEST_INPUT = "    [D]    \n\
+const char TEST_INPUT[] = "    [D]    \n\
 [N] [C]    \n\
 [Z] [M] [P]\n\
  1   2   3 \n\
@@ -11,7 +11,7 @@ move 3 from 1 to 3\n\
 move 2 from 2 to 1\n\
 move 1 from 1 to 2";
 
-const char* ACTUAL_INPUT = "        [H]     [W] [B]            \n\
+const char ACTUAL_INPUT[] = "        [H]     [W] [B]            \n\
     [D] [B]     [L] [G] [N]        \n\
 [P] [J] [T]     [M] [R] [D]        \n\
 [V] [F] [V]     [F] [Z] [B]     [C]\n\
@@ -0,0 +1,112 @@
+#ifndef PICO_MULTICORE_H
+#define PICO_MULTICORE_H
+
+#include <stdint.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief Depth of each inter-core FIFO, matching the RP2040 SIO
+ */
+#define HOST_FIFO_DEPTH 8
+
+/**
+ * @brief Host stand-in for one direction of the inter-core FIFO
+ */
+typedef struct
+{
+    std::mutex lock;
+    std::condition_variable changed;
+    std::deque<uint32_t> values;
+} HostFifo;
+
+/**
+ * @brief Host stand-in for core 1, a thread running the launched entry point.
+ * Joined when reset, or when the program exits.
+ */
+struct HostCore1
+{
+    std::thread thread;
+
+    ~HostCore1()
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+};
+
+inline HostFifo hostFifos[2];
+inline HostCore1 hostCore1;
+inline thread_local bool hostIsCore1 = false;
+
+/**
+ * @brief Waits for core 1 to return from its entry point, so it can be launched again.
+ * Unlike the board, the host can't stop core 1 mid-way.
+ */
+inline void multicore_reset_core1()
+{
+    if (hostCore1.thread.joinable())
+    {
+        hostCore1.thread.join();
+    }
+
+    for (HostFifo &fifo : hostFifos)
+    {
+        std::lock_guard<std::mutex> guard(fifo.lock);
+        fifo.values.clear();
+    }
+}
+
+/**
+ * @brief Runs entry on core 1, a new thread on the host
+ *
+ * @param entry
+ */
+inline void multicore_launch_core1(void (*entry)(void))
+{
+    multicore_reset_core1();
+
+    hostCore1.thread = std::thread([entry] {
+        hostIsCore1 = true;
+        entry();
+    });
+}
+
+/**
+ * @brief Pushes a value to the other core, waiting while its FIFO is full
+ *
+ * @param value
+ */
+inline void multicore_fifo_push_blocking(uint32_t value)
+{
+    HostFifo &fifo = hostFifos[!hostIsCore1];
+    std::unique_lock<std::mutex> guard(fifo.lock);
+
+    fifo.changed.wait(guard, [&] { return fifo.values.size() < HOST_FIFO_DEPTH; });
+    fifo.values.push_back(value);
+    fifo.changed.notify_all();
+}
+
+/**
+ * @brief Pops a value sent by the other core, waiting while there is none
+ *
+ * @return uint32_t
+ */
+inline uint32_t multicore_fifo_pop_blocking()
+{
+    HostFifo &fifo = hostFifos[hostIsCore1];
+    std::unique_lock<std::mutex> guard(fifo.lock);
+
+    fifo.changed.wait(guard, [&] { return !fifo.values.empty(); });
+
+    uint32_t value = fifo.values.front();
+    fifo.values.pop_front();
+    fifo.changed.notify_all();
+    return value;
+}
+
+#endif /* PICO_MULTICORE_H */
@@ -0,0 +1,42 @@
+#ifndef PICO_STDLIB_H
+#define PICO_STDLIB_H
+
+#include <stdint.h>
+#include <chrono>
+#include <thread>
+
+/**
+ * @brief Host shim for the Pico SDK stdlib
+ * Only the calls used by each day are provided. stdio is already
+ * available on the host, so initializing it is a no-op.
+ *
+ * @return true
+ */
+inline bool stdio_init_all()
+{
+    return true;
+}
+
+/**
+ * @brief Sleeps the calling thread for the given number of milliseconds
+ *
+ * @param ms
+ */
+inline void sleep_ms(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+/**
+ * @brief Microseconds since an arbitrary point, standing in for the RP2040 timer
+ *
+ * @return uint64_t
+ */
+inline uint64_t time_us_64()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+#endif /* PICO_STDLIB_H */